@@ -89,6 +89,15 @@ function( NEST_PRINT_CONFIG_SUMMARY )
     message( "Use Readline        : No" )
   endif ()
 
+  if ( HAVE_ZLIB )
+    message( "Use zlib            : Yes (zlib ${ZLIB_VERSION_STRING})" )
+    message( "    Includes        : ${ZLIB_INCLUDE_DIRS}" )
+    message( "    Libraries       : ${ZLIB_LIBRARIES}" )
+    message( "" )
+  else ()
+    message( "Use zlib            : No" )
+  endif ()
+
   if ( HAVE_LIBLTDL )
     message( "Use libltdl         : Yes (LTDL ${LTDL_VERSION})" )
     message( "    Includes        : ${LTDL_INCLUDE_DIRS}" )
@@ -152,6 +161,12 @@ function( NEST_PRINT_CONFIG_SUMMARY )
     message( "Use Boost           : No" )
   endif ()
 
+  if ( TIMER_DETAILED )
+    message( "Use detailed timers : Yes" )
+  else ()
+    message( "Use detailed timers : No" )
+  endif ()
+
   if ( HAVE_RECORDINGBACKEND_ARBOR  )
     message( "Use recording backend Arbor   : Yes" )
   else ()
@@ -313,6 +313,12 @@ function( NEST_PROCESS_WITH_PS_ARRAY )
   endif ()
 endfunction()
 
+function( NEST_PROCESS_WITH_DETAILED_TIMERS )
+  if ( with-detailed-timers )
+    set( TIMER_DETAILED ON PARENT_SCOPE )
+  endif ()
+endfunction()
+
 # Depending on the user options, we search for required libraries and include dirs.
 
 function( NEST_PROCESS_WITH_LIBLTDL )
@@ -363,6 +369,30 @@ function( NEST_PROCESS_WITH_READLINE )
   endif ()
 endfunction()
 
+function( NEST_PROCESS_WITH_ZLIB )
+  # Find zlib
+  set( HAVE_ZLIB OFF PARENT_SCOPE )
+  if ( with-zlib )
+    if ( NOT ${with-zlib} STREQUAL "ON" )
+      # a path is set
+      set( ZLIB_ROOT "${with-zlib}" )
+    endif ()
+
+    find_package( ZLIB )
+    if ( ZLIB_FOUND )
+      set( HAVE_ZLIB ON PARENT_SCOPE )
+      # export found variables to parent scope
+      set( ZLIB_FOUND "${ZLIB_FOUND}" PARENT_SCOPE )
+      set( ZLIB_LIBRARIES "${ZLIB_LIBRARIES}" PARENT_SCOPE )
+      set( ZLIB_INCLUDE_DIRS "${ZLIB_INCLUDE_DIRS}" PARENT_SCOPE )
+      set( ZLIB_VERSION_STRING "${ZLIB_VERSION_STRING}" PARENT_SCOPE )
+
+      include_directories( ${ZLIB_INCLUDE_DIRS} )
+      # is linked in nestkernel/CMakeLists.txt and extras/CMakeLists.txt
+    endif ()
+  endif ()
+endfunction()
+
 function( NEST_PROCESS_WITH_GSL )
   # Find GSL
   set( HAVE_GSL OFF PARENT_SCOPE )
@@ -0,0 +1,149 @@
+/*
+ *  nest_ascii_reader.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Reader for the files written by the ascii recording backend.
+ *
+ * Usage: nest_ascii_reader [-o output_file] file...
+ *
+ * The reader decompresses files written with the device property
+ * compressed set to true and passes uncompressed files through unchanged.
+ * Given the files of all threads and processes of a device, it writes
+ * their records to a single output, keeping only the header of the first
+ * file. A file that is still being written can be read up to the last
+ * flush of the backend, which happens at the end of each call to Run.
+ */
+
+// C++ includes:
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// External includes:
+#include <zlib.h>
+
+namespace
+{
+
+//! Number of header lines of a file, see RecordingBackendASCII::DeviceData::open_file()
+const int num_header_lines = 3;
+
+void
+print_usage()
+{
+  std::fprintf( stderr, "Usage: nest_ascii_reader [-o output_file] file...\n" );
+}
+
+/**
+ * Copy the file to out, skipping the header unless copy_header is true.
+ * Return false if the file cannot be read.
+ */
+bool
+copy_file( const std::string& filename, FILE* out, bool copy_header )
+{
+  gzFile file = gzopen( filename.c_str(), "rb" );
+  if ( not file )
+  {
+    return false;
+  }
+  gzbuffer( file, 1 << 16 );
+
+  std::vector< char > line( 1 << 16 );
+  int line_number = 0;
+  bool at_line_start = true;
+  while ( gzgets( file, line.data(), line.size() ) )
+  {
+    if ( at_line_start )
+    {
+      ++line_number;
+    }
+    if ( copy_header or line_number > num_header_lines )
+    {
+      std::fputs( line.data(), out );
+    }
+    // lines longer than the buffer are read in several pieces
+    const size_t length = std::strlen( line.data() );
+    at_line_start = length > 0 and line[ length - 1 ] == '\n';
+  }
+
+  int error;
+  gzerror( file, &error );
+  gzclose( file );
+
+  // a truncated stream is the normal case for a file that is still written
+  return error == Z_OK or error == Z_BUF_ERROR;
+}
+
+} // namespace
+
+int
+main( int argc, char* argv[] )
+{
+  std::string output_filename;
+  std::vector< std::string > filenames;
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string arg( argv[ i ] );
+    if ( arg == "-o" and i + 1 < argc )
+    {
+      output_filename = argv[ ++i ];
+    }
+    else if ( arg[ 0 ] != '-' )
+    {
+      filenames.push_back( arg );
+    }
+    else
+    {
+      print_usage();
+      return 2;
+    }
+  }
+  if ( filenames.empty() )
+  {
+    print_usage();
+    return 2;
+  }
+
+  FILE* out = output_filename.empty() ? stdout : std::fopen( output_filename.c_str(), "w" );
+  if ( not out )
+  {
+    std::fprintf( stderr, "nest_ascii_reader: cannot open output file '%s'\n", output_filename.c_str() );
+    return 1;
+  }
+
+  int status = 0;
+  for ( size_t i = 0; i < filenames.size(); ++i )
+  {
+    if ( not copy_file( filenames[ i ], out, i == 0 ) )
+    {
+      std::fprintf( stderr, "nest_ascii_reader: cannot read file '%s'\n", filenames[ i ].c_str() );
+      status = 1;
+    }
+  }
+
+  if ( out != stdout )
+  {
+    std::fclose( out );
+  }
+  return status;
+}
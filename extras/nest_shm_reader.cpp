@@ -0,0 +1,238 @@
+/*
+ *  nest_shm_reader.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Minimal consumer of the shared-memory segments written by the
+ * shared_memory recording backend.
+ *
+ * Usage: nest_shm_reader [-f] [-o output_file] segment_name
+ *
+ * The reader prints one line per record, holding the node ID of the
+ * recording device, the node ID of the sender, the time step, the offset
+ * and the values of the record. It starts with the oldest record held by
+ * the segment and stops when it has read all records written so far. With
+ * -f, it keeps waiting for new records until it is interrupted. Records
+ * that were overwritten before they could be read are counted and
+ * reported at the end.
+ *
+ * The reader only depends on shared_memory_stream.h, so it serves as an
+ * example for consumers that process the data directly.
+ */
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "shared_memory_stream.h"
+
+namespace
+{
+
+/**
+ * Number of polls without a new record after which a reader that does not
+ * follow the segment assumes that no writer is active.
+ */
+const int max_idle_polls = 1000;
+
+//! Time between two polls of the segment in microseconds
+const useconds_t poll_interval = 1000;
+
+void
+print_usage()
+{
+  std::fprintf( stderr, "Usage: nest_shm_reader [-f] [-o output_file] segment_name\n" );
+}
+
+} // namespace
+
+int
+main( int argc, char* argv[] )
+{
+  bool follow = false;
+  std::string output_filename;
+  std::string segment;
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string arg( argv[ i ] );
+    if ( arg == "-f" )
+    {
+      follow = true;
+    }
+    else if ( arg == "-o" and i + 1 < argc )
+    {
+      output_filename = argv[ ++i ];
+    }
+    else if ( segment.empty() and arg[ 0 ] != '-' )
+    {
+      segment = arg;
+    }
+    else
+    {
+      print_usage();
+      return 2;
+    }
+  }
+  if ( segment.empty() )
+  {
+    print_usage();
+    return 2;
+  }
+
+  const int fd = shm_open( segment.c_str(), O_RDONLY, 0 );
+  struct stat segment_status;
+  if ( fd < 0 or fstat( fd, &segment_status ) < 0
+    or static_cast< size_t >( segment_status.st_size ) < nest::shared_memory_stream_data_offset )
+  {
+    std::fprintf( stderr, "nest_shm_reader: cannot open segment '%s'\n", segment.c_str() );
+    return 1;
+  }
+  const size_t size = segment_status.st_size;
+  void* data = mmap( NULL, size, PROT_READ, MAP_SHARED, fd, 0 );
+  close( fd );
+  if ( data == MAP_FAILED )
+  {
+    std::fprintf( stderr, "nest_shm_reader: cannot map segment '%s'\n", segment.c_str() );
+    return 1;
+  }
+
+  const char* bytes = static_cast< const char* >( data );
+  const nest::SharedMemoryStreamHeader* header = static_cast< const nest::SharedMemoryStreamHeader* >( data );
+  if ( std::memcmp( header->magic, nest::shared_memory_stream_magic, sizeof( header->magic ) ) != 0
+    or nest::shared_memory_stream_data_offset + header->capacity * header->slot_size > size )
+  {
+    std::fprintf( stderr, "nest_shm_reader: '%s' is not a NEST shared-memory segment\n", segment.c_str() );
+    return 1;
+  }
+  const uint64_t capacity = header->capacity;
+  const size_t slot_size = header->slot_size;
+
+  FILE* out = output_filename.empty() ? stdout : std::fopen( output_filename.c_str(), "w" );
+  if ( not out )
+  {
+    std::fprintf( stderr, "nest_shm_reader: cannot open output file '%s'\n", output_filename.c_str() );
+    return 1;
+  }
+  std::fprintf( out, "# device sender time_step offset values (resolution %g ms)\n", header->resolution );
+
+  std::vector< char > record_copy( slot_size );
+  const nest::SharedMemoryStreamRecord* copy =
+    reinterpret_cast< const nest::SharedMemoryStreamRecord* >( record_copy.data() );
+
+  uint64_t next = 0;
+  uint64_t lost = 0;
+  int idle_polls = 0;
+  while ( follow or idle_polls < max_idle_polls )
+  {
+    const uint64_t written = header->write_sequence.load( std::memory_order_acquire );
+    if ( written > next + capacity )
+    {
+      lost += written - capacity - next;
+      next = written - capacity;
+    }
+
+    bool progress = false;
+    while ( next < written )
+    {
+      const char* slot = bytes + nest::shared_memory_stream_data_offset + ( next % capacity ) * slot_size;
+      const nest::SharedMemoryStreamRecord* record = reinterpret_cast< const nest::SharedMemoryStreamRecord* >( slot );
+
+      const uint64_t sequence = record->sequence.load( std::memory_order_acquire );
+      if ( sequence < next + 1 )
+      {
+        break; // the record is still being written
+      }
+
+      // The copy is only valid if the slot has not been overwritten meanwhile.
+      std::memcpy( record_copy.data() + sizeof( std::atomic< uint64_t > ),
+        slot + sizeof( std::atomic< uint64_t > ),
+        slot_size - sizeof( std::atomic< uint64_t > ) );
+      std::atomic_thread_fence( std::memory_order_acquire );
+      if ( sequence != next + 1 or record->sequence.load( std::memory_order_relaxed ) != next + 1 )
+      {
+        ++lost;
+        ++next;
+        continue;
+      }
+
+      std::fprintf( out,
+        "%llu %llu %lld %g",
+        static_cast< unsigned long long >( copy->device ),
+        static_cast< unsigned long long >( copy->sender ),
+        static_cast< long long >( copy->time_step ),
+        copy->offset );
+      const char* values = record_copy.data() + sizeof( nest::SharedMemoryStreamRecord );
+      for ( uint32_t j = 0; j < copy->n_double_values; ++j )
+      {
+        double value;
+        std::memcpy( &value, values + j * sizeof( double ), sizeof( double ) );
+        std::fprintf( out, " %.17g", value );
+      }
+      values += copy->n_double_values * sizeof( double );
+      for ( uint32_t j = 0; j < copy->n_long_values; ++j )
+      {
+        int64_t value;
+        std::memcpy( &value, values + j * sizeof( int64_t ), sizeof( int64_t ) );
+        std::fprintf( out, " %lld", static_cast< long long >( value ) );
+      }
+      std::fprintf( out, "\n" );
+
+      ++next;
+      progress = true;
+    }
+
+    if ( progress )
+    {
+      std::fflush( out );
+      idle_polls = 0;
+    }
+    else if ( next == written and not follow )
+    {
+      break; // all records written so far have been read
+    }
+    else
+    {
+      ++idle_polls;
+      usleep( poll_interval );
+    }
+  }
+
+  if ( lost > 0 )
+  {
+    std::fprintf( stderr, "nest_shm_reader: %llu records were overwritten before they were read\n",
+      static_cast< unsigned long long >( lost ) );
+  }
+
+  if ( out != stdout )
+  {
+    std::fclose( out );
+  }
+  munmap( data, size );
+  return 0;
+}
@@ -0,0 +1,268 @@
+/*
+ *  binned_correlator.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "binned_correlator.h"
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+// Includes from libnestutil:
+#include "fft.h"
+
+namespace
+{
+
+//! Minimal size of the transforms, so that short lags still use long blocks
+const long min_fft_size = 1024;
+
+/**
+ * Split the spectrum z of the packed real signals x + i y at index k into
+ * the spectra of x and y, using that the spectra of real signals are
+ * hermitian. nk is the index of the negative frequency, ( L - k ) mod L.
+ */
+inline void
+unpack( const std::vector< std::complex< double > >& z,
+  size_t k,
+  size_t nk,
+  std::complex< double >& x,
+  std::complex< double >& y )
+{
+  const std::complex< double > zk = z[ k ];
+  const std::complex< double > znk = std::conj( z[ nk ] );
+  x = 0.5 * ( zk + znk );
+  y = std::complex< double >( 0., -0.5 ) * ( zk - znk );
+}
+
+} // namespace
+
+nest::BinnedCorrelator::BinnedCorrelator()
+{
+  reset( 1, 0, 0, 0 );
+}
+
+void
+nest::BinnedCorrelator::reset( size_t n_channels, long max_lag, long count_from, long count_until )
+{
+  assert( n_channels > 0 and max_lag >= 0 );
+
+  n_channels_ = n_channels;
+  max_lag_ = max_lag;
+  count_until_ = count_until;
+
+  // the transform must hold a block and the history of max_lag steps
+  // without wrapping correlations with lags up to max_lag around, so
+  // blocks are at least half as long as the transform
+  fft_size_ = fft_size( std::max( 4 * max_lag_, min_fft_size ) );
+  block_size_ = fft_size_ - 2 * max_lag_;
+
+  first_ = count_from - max_lag_;
+  done_ = count_from;
+
+  weights_.clear();
+  weights_.resize( n_channels_ );
+  counts_.clear();
+  counts_.resize( n_channels_ );
+  squares_.clear();
+  squares_.resize( n_channels_ );
+
+  const size_t n_pairs = n_channels_ * ( n_channels_ + 1 ) / 2;
+  weighted_.clear();
+  weighted_.resize( n_pairs, std::vector< double >( 2 * max_lag_ + 1, 0. ) );
+  count_.clear();
+  count_.resize( n_pairs, std::vector< long >( 2 * max_lag_ + 1, 0 ) );
+
+  weighted_squares_.clear();
+  weighted_squares_.resize( n_channels_, 0. );
+  count_squares_.clear();
+  count_squares_.resize( n_channels_, 0 );
+
+  spectrum_all_.clear();
+  spectrum_all_.resize( n_channels_ );
+  spectrum_history_.clear();
+  spectrum_history_.resize( n_channels_ );
+}
+
+void
+nest::BinnedCorrelator::add( size_t channel, long step, double weight, long multiplicity )
+{
+  assert( channel < n_channels_ );
+  if ( step < first_ or step >= count_until_ )
+  {
+    return;
+  }
+
+  const size_t i = step - first_;
+  if ( i >= weights_[ channel ].size() )
+  {
+    weights_[ channel ].resize( i + 1, 0. );
+    counts_[ channel ].resize( i + 1, 0. );
+    squares_[ channel ].resize( i + 1, 0. );
+  }
+
+  const double w = multiplicity * weight;
+  weights_[ channel ][ i ] += w;
+  counts_[ channel ][ i ] += multiplicity;
+  squares_[ channel ][ i ] += w * w;
+}
+
+void
+nest::BinnedCorrelator::process( long until )
+{
+  until = std::min( until, count_until_ );
+  while ( done_ < until )
+  {
+    process_block_( std::min( until, done_ + block_size_ ) );
+  }
+}
+
+void
+nest::BinnedCorrelator::process_block_( long until )
+{
+  const size_t n_steps = until - done_;
+  const size_t history = max_lag_;
+  const size_t n_data = history + n_steps;
+  assert( n_steps <= static_cast< size_t >( block_size_ ) );
+  assert( first_ == done_ - max_lag_ );
+
+  // channels without spikes in the block and its history do not contribute
+  std::vector< bool > has_data( n_channels_, false );
+  bool block_has_data = false;
+  for ( size_t c = 0; c < n_channels_; ++c )
+  {
+    const size_t end = std::min( counts_[ c ].size(), n_data );
+    for ( size_t i = 0; i < end; ++i )
+    {
+      if ( counts_[ c ][ i ] != 0. )
+      {
+        has_data[ c ] = true;
+        block_has_data = block_has_data or i >= history;
+      }
+    }
+  }
+
+  if ( block_has_data )
+  {
+    // the spectra of the weights and multiplicities are computed by a
+    // single transform of the complex signal weights + i multiplicities
+    for ( size_t c = 0; c < n_channels_; ++c )
+    {
+      if ( not has_data[ c ] )
+      {
+        continue;
+      }
+      std::vector< std::complex< double > >& all = spectrum_all_[ c ];
+      std::vector< std::complex< double > >& hist = spectrum_history_[ c ];
+      all.assign( fft_size_, 0. );
+      hist.assign( fft_size_, 0. );
+
+      const size_t end = std::min( counts_[ c ].size(), n_data );
+      for ( size_t i = 0; i < end; ++i )
+      {
+        all[ i ] = std::complex< double >( weights_[ c ][ i ], counts_[ c ][ i ] );
+        if ( i < history )
+        {
+          hist[ i ] = all[ i ];
+        }
+        else
+        {
+          weighted_squares_[ c ] += squares_[ c ][ i ];
+          count_squares_[ c ] += std::llround( counts_[ c ][ i ] );
+        }
+      }
+      fft( all );
+      fft( hist );
+    }
+
+    // pairs of steps with the later one in the block are all pairs of the
+    // block and history, except the pairs within the history
+    std::vector< std::complex< double > > product( fft_size_ );
+    for ( size_t a = 0; a < n_channels_; ++a )
+    {
+      for ( size_t b = a; b < n_channels_; ++b )
+      {
+        if ( not has_data[ a ] or not has_data[ b ] )
+        {
+          continue;
+        }
+
+        std::complex< double > wa, ca, wb, cb, wha, cha, whb, chb;
+        for ( size_t k = 0; k < fft_size_; ++k )
+        {
+          const size_t nk = ( fft_size_ - k ) & ( fft_size_ - 1 );
+          unpack( spectrum_all_[ a ], k, nk, wa, ca );
+          unpack( spectrum_all_[ b ], k, nk, wb, cb );
+          unpack( spectrum_history_[ a ], k, nk, wha, cha );
+          unpack( spectrum_history_[ b ], k, nk, whb, chb );
+          const std::complex< double > weighted = wa * std::conj( wb ) - wha * std::conj( whb );
+          const std::complex< double > count = ca * std::conj( cb ) - cha * std::conj( chb );
+          // both correlations are real, so one inverse transform yields both
+          product[ k ] = weighted + std::complex< double >( 0., 1. ) * count;
+        }
+        fft( product, true );
+
+        std::vector< double >& weighted = weighted_[ pair_index_( a, b ) ];
+        std::vector< long >& count = count_[ pair_index_( a, b ) ];
+        for ( long lag = -max_lag_; lag <= max_lag_; ++lag )
+        {
+          const std::complex< double >& f = product[ lag < 0 ? fft_size_ + lag : lag ];
+          weighted[ lag + max_lag_ ] += f.real();
+          count[ lag + max_lag_ ] += std::llround( f.imag() );
+        }
+      }
+    }
+  }
+
+  // keep the last max_lag steps as history of the next block
+  for ( size_t c = 0; c < n_channels_; ++c )
+  {
+    const size_t n_drop = std::min( counts_[ c ].size(), n_steps );
+    weights_[ c ].erase( weights_[ c ].begin(), weights_[ c ].begin() + n_drop );
+    counts_[ c ].erase( counts_[ c ].begin(), counts_[ c ].begin() + n_drop );
+    squares_[ c ].erase( squares_[ c ].begin(), squares_[ c ].begin() + n_drop );
+  }
+  first_ += n_steps;
+  done_ = until;
+}
+
+double
+nest::BinnedCorrelator::get_weighted( size_t a, size_t b, long lag ) const
+{
+  assert( -max_lag_ <= lag and lag <= max_lag_ );
+  return a <= b ? weighted_[ pair_index_( a, b ) ][ lag + max_lag_ ]
+                : weighted_[ pair_index_( b, a ) ][ max_lag_ - lag ];
+}
+
+long
+nest::BinnedCorrelator::get_count( size_t a, size_t b, long lag ) const
+{
+  assert( -max_lag_ <= lag and lag <= max_lag_ );
+  return a <= b ? count_[ pair_index_( a, b ) ][ lag + max_lag_ ] : count_[ pair_index_( b, a ) ][ max_lag_ - lag ];
+}
+
+size_t
+nest::BinnedCorrelator::pair_index_( size_t a, size_t b ) const
+{
+  assert( a <= b and b < n_channels_ );
+  return a * n_channels_ - a * ( a + 1 ) / 2 + b;
+}
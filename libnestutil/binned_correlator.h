@@ -0,0 +1,148 @@
+/*
+ *  binned_correlator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BINNED_CORRELATOR_H
+#define BINNED_CORRELATOR_H
+
+// C++ includes:
+#include <complex>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Block-wise computation of the cross-correlations of binned spike trains.
+ *
+ * The correlator collects the summed weights and multiplicities of the
+ * spikes of each channel per simulation step, x_a[t]. For all pairs of
+ * channels a <= b it accumulates the correlation functions
+ *
+ *   F_ab[d] = sum_t x_a[t + d] x_b[t],  -max_lag <= d <= max_lag,
+ *
+ * of the weights and of the multiplicities, counting each pair of steps
+ * once, if the later of the two steps lies in [count_from, count_until).
+ * F_ba[d] = F_ab[-d] covers the other pairs of channels.
+ *
+ * Steps are processed in blocks: process() correlates all steps of a
+ * block with each other and with the max_lag steps before the block,
+ * using the fast Fourier transform. All steps before the block must have
+ * been processed and all spikes in the block must have been added, so
+ * process( until ) must only be called once all spikes with steps before
+ * until are known. The cost per block of B steps and N channels is
+ * O( ( N + N^2 / 2 ) L log L ) with L = B + 2 max_lag rounded up to a
+ * power of two, instead of the cost proportional to the number of spike
+ * pairs of the spike-by-spike computation.
+ */
+class BinnedCorrelator
+{
+public:
+  BinnedCorrelator();
+
+  /**
+   * Clear all data and prepare for the given number of channels and
+   * maximal lag in steps.
+   */
+  void reset( size_t n_channels, long max_lag, long count_from, long count_until );
+
+  /**
+   * Add a spike with the given weight and multiplicity. Spikes before
+   * count_from - max_lag and after count_until cannot contribute and are
+   * ignored.
+   */
+  void add( size_t channel, long step, double weight, long multiplicity );
+
+  /**
+   * Correlate all steps before until, which have not been processed yet.
+   */
+  void process( long until );
+
+  //! Return the first step that has not been processed yet
+  long
+  get_processed_until() const
+  {
+    return done_;
+  }
+
+  //! Return the number of steps processed at once
+  long
+  get_block_size() const
+  {
+    return block_size_;
+  }
+
+  //! Return F_ab[lag] of the weights
+  double get_weighted( size_t a, size_t b, long lag ) const;
+
+  //! Return F_ab[lag] of the multiplicities
+  long get_count( size_t a, size_t b, long lag ) const;
+
+  //! Return the sum of the squared weights of the single spikes of channel a
+  double
+  get_weighted_squares( size_t a ) const
+  {
+    return weighted_squares_[ a ];
+  }
+
+  //! Return the sum of the multiplicities of the spikes of channel a
+  long
+  get_count_squares( size_t a ) const
+  {
+    return count_squares_[ a ];
+  }
+
+private:
+  //! Index of the pair a <= b in the vectors of correlation functions
+  size_t pair_index_( size_t a, size_t b ) const;
+
+  //! Process the steps from done_ to until in one block
+  void process_block_( long until );
+
+  size_t n_channels_;
+  long max_lag_;
+  long count_until_;
+  long block_size_;
+  size_t fft_size_;
+
+  long first_; //!< step of the first entry of the data vectors
+  long done_;  //!< first step that has not been processed yet
+
+  //! Summed weights, multiplicities and squared weights per channel and step
+  std::vector< std::vector< double > > weights_;
+  std::vector< std::vector< double > > counts_;
+  std::vector< std::vector< double > > squares_;
+
+  //! Correlation functions of all pairs a <= b, indexed by lag + max_lag
+  std::vector< std::vector< double > > weighted_;
+  std::vector< std::vector< long > > count_;
+
+  std::vector< double > weighted_squares_;
+  std::vector< long > count_squares_;
+
+  //! Spectra of the data of each channel, weights packed with multiplicities
+  std::vector< std::vector< std::complex< double > > > spectrum_all_;
+  std::vector< std::vector< std::complex< double > > > spectrum_history_;
+};
+
+} // namespace nest
+
+#endif // BINNED_CORRELATOR_H
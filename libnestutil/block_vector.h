@@ -234,11 +234,24 @@ public:
    */
   void clear();
 
+  /**
+   * @brief Allocate blocks for at least n elements.
+   *
+   * Subsequent calls to push_back() do not allocate memory until the
+   * BlockVector holds n elements.
+   */
+  void reserve( size_t n );
+
   /**
    * Returns the number of elements in the BlockVector.
    */
   size_t size() const;
 
+  /**
+   * Returns the number of elements for which memory has been allocated.
+   */
+  size_t capacity() const;
+
   /**
    * @brief Remove a range of elements.
    * @param first Iterator pointing to the first element to be erased.
@@ -387,8 +400,9 @@ template < typename value_type_ >
 inline void
 BlockVector< value_type_ >::push_back( const value_type_& value )
 {
-  // If this is the last element in the current block, add another block
-  if ( finish_.block_it_ == finish_.current_block_end_ - 1 )
+  // If this is the last element in the current block, add another block,
+  // unless it has been allocated already by reserve()
+  if ( finish_.block_it_ == finish_.current_block_end_ - 1 and finish_.block_index_ + 1 == blockmap_.size() )
   {
     blockmap_.emplace_back( max_block_size );
   }
@@ -410,6 +424,22 @@ BlockVector< value_type_ >::clear()
   finish_ = begin();
 }
 
+template < typename value_type_ >
+inline void
+BlockVector< value_type_ >::reserve( size_t n )
+{
+  // There is always a block following the block holding the final element.
+  const size_t num_blocks_needed = n / max_block_size + 1;
+  if ( num_blocks_needed > blockmap_.size() )
+  {
+    blockmap_.reserve( num_blocks_needed );
+    while ( blockmap_.size() < num_blocks_needed )
+    {
+      blockmap_.emplace_back( max_block_size );
+    }
+  }
+}
+
 template < typename value_type_ >
 inline size_t
 BlockVector< value_type_ >::size() const
@@ -427,6 +457,13 @@ BlockVector< value_type_ >::size() const
   return finish_.block_index_ * max_block_size + element_index;
 }
 
+template < typename value_type_ >
+inline size_t
+BlockVector< value_type_ >::capacity() const
+{
+  return blockmap_.size() * max_block_size;
+}
+
 template < typename value_type_ >
 inline typename BlockVector< value_type_ >::iterator
 BlockVector< value_type_ >::erase( const_iterator first, const_iterator last )
@@ -0,0 +1,91 @@
+/*
+ *  fft.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "fft.h"
+
+// C++ includes:
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+void
+nest::fft( std::vector< std::complex< double > >& data, bool inverse )
+{
+  const size_t n = data.size();
+  assert( n > 0 and ( n & ( n - 1 ) ) == 0 );
+
+  // reorder the data by bit-reversed indices
+  for ( size_t i = 1, j = 0; i < n; ++i )
+  {
+    size_t bit = n >> 1;
+    for ( ; j & bit; bit >>= 1 )
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+    if ( i < j )
+    {
+      std::swap( data[ i ], data[ j ] );
+    }
+  }
+
+  // combine transforms of length len / 2 to transforms of length len
+  const double sign = inverse ? 1. : -1.;
+  for ( size_t len = 2; len <= n; len <<= 1 )
+  {
+    const double angle = sign * 2. * M_PI / len;
+    const size_t half = len / 2;
+    for ( size_t k = 0; k < half; ++k )
+    {
+      // computing each twiddle factor directly avoids the accumulation
+      // of rounding errors of a recursively updated factor
+      const std::complex< double > w( std::cos( angle * k ), std::sin( angle * k ) );
+      for ( size_t i = k; i < n; i += len )
+      {
+        const std::complex< double > u = data[ i ];
+        const std::complex< double > v = data[ i + half ] * w;
+        data[ i ] = u + v;
+        data[ i + half ] = u - v;
+      }
+    }
+  }
+
+  if ( inverse )
+  {
+    const double scale = 1. / n;
+    for ( size_t i = 0; i < n; ++i )
+    {
+      data[ i ] *= scale;
+    }
+  }
+}
+
+size_t
+nest::fft_size( size_t n )
+{
+  size_t size = 1;
+  while ( size < n )
+  {
+    size <<= 1;
+  }
+  return size;
+}
@@ -0,0 +1,51 @@
+/*
+ *  fft.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+// C++ includes:
+#include <complex>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Compute the discrete Fourier transform of data in place.
+ *
+ * The iterative radix-2 Cooley-Tukey algorithm is used, so the size of
+ * data must be a power of two. The forward transform computes
+ * X_k = sum_n x_n exp( -2 pi i k n / N ), the inverse transform uses the
+ * opposite sign and is scaled by 1/N, so that it exactly inverts the
+ * forward transform.
+ */
+void fft( std::vector< std::complex< double > >& data, bool inverse = false );
+
+/**
+ * Return the smallest power of two that is not smaller than n.
+ */
+size_t fft_size( size_t n );
+
+} // namespace nest
+
+#endif // FFT_H
@@ -24,6 +24,9 @@
 
 #ifdef HAVE_GSL
 
+// C++ includes:
+#include <iostream>
+
 // nothing if GSL 1.2 or later not available
 
 librandom::GslRandomGen::GslRandomGen( const gsl_rng_type* type, unsigned long seed )
@@ -40,6 +43,18 @@ librandom::GslRandomGen::~GslRandomGen()
   gsl_rng_free( rng_ );
 }
 
+void
+librandom::GslRandomGen::write_state( std::ostream& os ) const
+{
+  os.write( static_cast< const char* >( gsl_rng_state( rng_ ) ), gsl_rng_size( rng_ ) );
+}
+
+void
+librandom::GslRandomGen::read_state( std::istream& is )
+{
+  is.read( static_cast< char* >( gsl_rng_state( rng_ ) ), gsl_rng_size( rng_ ) );
+}
+
 // function initializing RngList
 // add further self-implemented RNG below
 void
@@ -83,6 +83,8 @@ public:
     return RngPtr( new GslRandomGen( rng_type_, s ) );
   }
 
+  void write_state( std::ostream& ) const;
+  void read_state( std::istream& );
 
 private:
   void seed_( unsigned long );
@@ -30,6 +30,9 @@
 
 #include "knuthlfg.h"
 
+// C++ includes:
+#include <iostream>
+
 const long librandom::KnuthLFG::KK_ = 100;
 const long librandom::KnuthLFG::LL_ = 37;
 const long librandom::KnuthLFG::MM_ = 1L << 30;
@@ -154,3 +157,22 @@ librandom::KnuthLFG::self_test_()
   }
   assert( tbuff[ 0 ] == 995235265 );
 }
+
+void
+librandom::KnuthLFG::write_state( std::ostream& os ) const
+{
+  const long next = next_ - ran_buffer_.begin();
+  os.write( reinterpret_cast< const char* >( &ran_x_[ 0 ] ), ran_x_.size() * sizeof( long ) );
+  os.write( reinterpret_cast< const char* >( &ran_buffer_[ 0 ] ), ran_buffer_.size() * sizeof( long ) );
+  os.write( reinterpret_cast< const char* >( &next ), sizeof( long ) );
+}
+
+void
+librandom::KnuthLFG::read_state( std::istream& is )
+{
+  long next;
+  is.read( reinterpret_cast< char* >( &ran_x_[ 0 ] ), ran_x_.size() * sizeof( long ) );
+  is.read( reinterpret_cast< char* >( &ran_buffer_[ 0 ] ), ran_buffer_.size() * sizeof( long ) );
+  is.read( reinterpret_cast< char* >( &next ), sizeof( long ) );
+  next_ = ran_buffer_.begin() + next;
+}
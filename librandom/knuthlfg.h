@@ -59,6 +59,9 @@ public:
     return RngPtr( new KnuthLFG( s ) );
   }
 
+  void write_state( std::ostream& ) const;
+  void read_state( std::istream& );
+
 private:
   //! implements seeding for RandomGen
   void seed_( unsigned long );
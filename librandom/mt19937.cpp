@@ -57,6 +57,9 @@
 
 #include "mt19937.h"
 
+// C++ includes:
+#include <iostream>
+
 const unsigned int librandom::MT19937::N = 624;
 const unsigned int librandom::MT19937::M = 397;
 const unsigned long librandom::MT19937::MATRIX_A = 0x9908b0dfUL;
@@ -135,3 +138,17 @@ librandom::MT19937::genrand_int32()
 
   return y;
 }
+
+void
+librandom::MT19937::write_state( std::ostream& os ) const
+{
+  os.write( reinterpret_cast< const char* >( &mt[ 0 ] ), mt.size() * sizeof( unsigned long ) );
+  os.write( reinterpret_cast< const char* >( &mti ), sizeof( int ) );
+}
+
+void
+librandom::MT19937::read_state( std::istream& is )
+{
+  is.read( reinterpret_cast< char* >( &mt[ 0 ] ), mt.size() * sizeof( unsigned long ) );
+  is.read( reinterpret_cast< char* >( &mti ), sizeof( int ) );
+}
@@ -86,6 +86,9 @@ public:
     return RngPtr( new MT19937( s ) );
   }
 
+  void write_state( std::ostream& ) const;
+  void read_state( std::istream& );
+
 private:
   //! implements seeding for RandomGen
   void seed_( unsigned long );
@@ -24,6 +24,7 @@
 
 // Includes from librandom:
 #include "knuthlfg.h"
+#include "librandom_exceptions.h"
 
 const unsigned long librandom::RandomGen::DefaultSeed = 0xd37ca59fUL;
 
@@ -39,3 +40,15 @@ librandom::RandomGen::create_knuthlfg_rng( unsigned long seed )
 {
   return librandom::RngPtr( new librandom::KnuthLFG( seed ) );
 }
+
+void
+librandom::RandomGen::write_state( std::ostream& ) const
+{
+  throw UnsuitableRNG( "The random number generator does not support writing its state." );
+}
+
+void
+librandom::RandomGen::read_state( std::istream& )
+{
+  throw UnsuitableRNG( "The random number generator does not support reading its state." );
+}
@@ -193,6 +193,7 @@
 
 // C++ includes:
 #include <cmath>
+#include <iosfwd>
 #include <vector>
 
 #include <memory>
@@ -272,6 +273,19 @@ public:
   //! clone a random number generator of same type initialized with given seed
   virtual RngPtr clone( const unsigned long ) = 0;
 
+  /**
+   * Write the internal state of the generator in binary form, so that
+   * read_state() can continue the random number sequence from this point.
+   * The default implementation throws UnsuitableRNG.
+   */
+  virtual void write_state( std::ostream& ) const;
+
+  /**
+   * Restore the internal state written by write_state().
+   * The default implementation throws UnsuitableRNG.
+   */
+  virtual void read_state( std::istream& );
+
 protected:
   /**
      The following functions provide the interface to the actual
@@ -25,11 +25,15 @@
 // C++ includes:
 #include <cmath>      // for less
 #include <functional> // for bind2nd
+#include <limits>
 #include <numeric>
 
 // Includes from libnestutil:
 #include "dict_util.h"
 
+// Includes from nestkernel:
+#include "kernel_manager.h"
+
 // Includes from sli:
 #include "arraydatum.h"
 #include "dict.h"
@@ -45,6 +49,7 @@ nest::correlation_detector::Parameters_::Parameters_()
   , tau_max_( 10 * delta_tau_ )
   , Tstart_( Time::ms( 0.0 ) )
   , Tstop_( Time::pos_inf() )
+  , binned_( false )
 {
 }
 
@@ -53,6 +58,7 @@ nest::correlation_detector::Parameters_::Parameters_( const Parameters_& p )
   , tau_max_( p.tau_max_ )
   , Tstart_( p.Tstart_ )
   , Tstop_( p.Tstop_ )
+  , binned_( p.binned_ )
 {
   // Check for proper properties is not done here but in the
   // correlation_detector() copy c'tor. The check cannot be
@@ -72,6 +78,7 @@ nest::correlation_detector::State_::State_()
   , histogram_()
   , histogram_correction_()
   , count_histogram_()
+  , correlator_()
 {
 }
 
@@ -87,6 +94,7 @@ nest::correlation_detector::Parameters_::get( DictionaryDatum& d ) const
   ( *d )[ names::tau_max ] = tau_max_.get_ms();
   ( *d )[ names::Tstart ] = Tstart_.get_ms();
   ( *d )[ names::Tstop ] = Tstop_.get_ms();
+  ( *d )[ names::binned ] = binned_;
 }
 
 void
@@ -127,6 +135,13 @@ nest::correlation_detector::Parameters_::set( const DictionaryDatum& d, const co
     reset = true;
   }
 
+  bool binned = binned_;
+  if ( updateValueParam< bool >( d, names::binned, binned, node ) and binned != binned_ )
+  {
+    binned_ = binned;
+    reset = true;
+  }
+
   if ( not delta_tau_.is_step() )
   {
     throw StepMultipleRequired( n.get_name(), names::delta_tau, delta_tau_ );
@@ -182,6 +197,45 @@ nest::correlation_detector::State_::reset( const Parameters_& p )
 
   count_histogram_.clear();
   count_histogram_.resize( 1 + 2 * p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
+
+  if ( p.binned_ )
+  {
+    // lags of pairs in the histogram are in [-tau_edge, tau_edge)
+    const long max_lag = p.tau_max_.get_steps() + p.delta_tau_.get_steps() / 2;
+    // pairs are counted if the later spike lies in [Tstart, Tstop]
+    const long count_from = p.Tstart_.get_steps();
+    const long count_until = p.Tstop_.is_finite() ? p.Tstop_.get_steps() + ( p.Tstop_.is_step() ? 1 : 0 )
+                                                  : std::numeric_limits< long >::max();
+    correlator_.reset( 2, max_lag, count_from, count_until );
+  }
+  else
+  {
+    correlator_.reset( 1, 0, 0, 0 );
+  }
+}
+
+void
+nest::correlation_detector::State_::update_histograms( const Parameters_& p )
+{
+  std::fill( histogram_.begin(), histogram_.end(), 0. );
+  std::fill( count_histogram_.begin(), count_histogram_.end(), 0 );
+
+  const long delta_tau = p.delta_tau_.get_steps();
+  const long tau_max = p.tau_max_.get_steps();
+  const long max_lag = tau_max + delta_tau / 2;
+  for ( long lag = -max_lag; lag <= max_lag; ++lag )
+  {
+    // bin of the time difference t_2 - t_1 = lag as in handle(), computed
+    // from twice the distance of lag from -tau_edge to stay integer
+    const long twice_distance = 2 * tau_max + delta_tau + 2 * lag;
+    const size_t bin = twice_distance / ( 2 * delta_tau );
+    if ( twice_distance >= 0 and bin < histogram_.size() )
+    {
+      // correlation of source 2 with source 1 at the lag t_2 - t_1
+      histogram_[ bin ] += correlator_.get_weighted( 1, 0, lag );
+      count_histogram_[ bin ] += correlator_.get_count( 1, 0, lag );
+    }
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -246,8 +300,35 @@ nest::correlation_detector::calibrate()
  * ---------------------------------------------------------------- */
 
 void
-nest::correlation_detector::update( Time const&, const long, const long )
+nest::correlation_detector::update( Time const& origin, const long, const long )
 {
+  if ( P_.binned_ )
+  {
+    // with the pipelined spike exchange, the spikes of the previous slice
+    // may still be pending, so only the spikes up to its origin are complete
+    const long complete_until = origin.get_steps() - kernel().connection_manager.get_min_delay() + 1;
+    if ( complete_until - S_.correlator_.get_processed_until() >= S_.correlator_.get_block_size() )
+    {
+      process_binned_( complete_until );
+    }
+  }
+}
+
+void
+nest::correlation_detector::post_run_cleanup()
+{
+  if ( P_.binned_ )
+  {
+    // all spikes up to the end of the last complete slice have been delivered
+    process_binned_( kernel().simulation_manager.get_clock().get_steps() + 1 );
+  }
+}
+
+void
+nest::correlation_detector::process_binned_( long until )
+{
+  S_.correlator_.process( until );
+  S_.update_histograms( P_ );
 }
 
 void
@@ -266,6 +347,16 @@ nest::correlation_detector::handle( SpikeEvent& e )
 
   if ( device_.is_active( stamp ) )
   {
+    if ( P_.binned_ )
+    {
+      // the pairs are counted block-wise in update()
+      if ( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ )
+      {
+        S_.n_events_[ sender ]++;
+      }
+      S_.correlator_.add( sender, stamp.get_steps(), e.get_weight(), e.get_multiplicity() );
+      return;
+    }
 
     const long spike_i = stamp.get_steps();
     const port other = 1 - sender; // port of the neuron not sending
@@ -28,6 +28,9 @@
 #include <deque>
 #include <vector>
 
+// Includes from libnestutil:
+#include "binned_correlator.h"
+
 // Includes from nestkernel:
 #include "event.h"
 #include "nest_timeconverter.h"
@@ -118,8 +121,30 @@ histogram_correction list of  read-only - Correction factors for kahan summation
                      integers algoritm
 n_events             list of  Number of events from source 0 and 1. By setting
                      integers n_events to [0,0], the histogram is cleared.
+binned               boolean  Compute the histograms block-wise from the binned
+                              spike trains (see below). Default is false.
+                              Setting binned clears the histograms.
 ==================== ======== ==================================================
 
+Binned mode:
+
+If binned is true, handle() only adds each spike to the spike counts of
+its source per simulation step. Blocks of steps are correlated with each
+other and with the preceding tau_max+delta_tau/2 with a fast Fourier
+transform, so that the cost per block grows with its length L as
+L log(L) instead of with the number of spike pairs. This pays off for
+high rates and long tau_max. The histograms are updated after each block
+and at the end of each call to Run, where the last block is completed.
+Pairs of spikes are counted if the later of the two spikes lies in
+[Tstart, Tstop].
+
+For spikes of multiplicity one, count_histogram is identical to the one
+computed spike by spike and histogram equals it up to rounding errors.
+A spike of multiplicity m counts as m spikes in both histograms, while
+the spike-by-spike computation weights the count of a pair with the
+multiplicity of the spike arriving later. histogram_correction is not
+used in binned mode.
+
 Remarks:
 
 This recorder does not record to file, screen or memory in the usual
@@ -198,6 +223,11 @@ public:
 
   void calibrate_time( const TimeConverter& tc );
 
+  /**
+   * Complete the histograms of the binned mode.
+   */
+  void post_run_cleanup();
+
 private:
   void init_state_( Node const& );
   void init_buffers_();
@@ -205,6 +235,12 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Process the binned spike trains up to the given step and update the
+   * histograms.
+   */
+  void process_binned_( long until );
+
   // ------------------------------------------------------------
 
   /**
@@ -243,6 +279,7 @@ private:
     Time tau_max_;   //!< maximum time difference of events to detect
     Time Tstart_;    //!< start of recording
     Time Tstop_;     //!< end of recording
+    bool binned_;    //!< correlate binned spike trains block-wise
 
     Parameters_();                     //!< Sets default parameter values
     Parameters_( const Parameters_& ); //!< Recalibrate all times
@@ -284,6 +321,9 @@ private:
     //! Unweighted histogram.
     std::vector< long > count_histogram_;
 
+    //! Correlations of the binned spike trains in binned mode
+    BinnedCorrelator correlator_;
+
     State_(); //!< initialize default state
 
     void get( DictionaryDatum& ) const;
@@ -294,6 +334,9 @@ private:
     void set( const DictionaryDatum&, const Parameters_&, bool, Node* );
 
     void reset( const Parameters_& );
+
+    //! Compute the histograms from the correlations of the binned spike trains
+    void update_histograms( const Parameters_& );
   };
 
   // ------------------------------------------------------------
@@ -328,7 +371,7 @@ nest::correlation_detector::set_status( const DictionaryDatum& d )
   Parameters_ ptmp = P_;
   const bool reset_required = ptmp.set( d, *this, this );
   State_ stmp = S_;
-  stmp.set( d, P_, reset_required, this );
+  stmp.set( d, ptmp, reset_required, this );
 
   device_.set_status( d );
   P_ = ptmp;
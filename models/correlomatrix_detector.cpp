@@ -25,6 +25,7 @@
 // C++ includes:
 #include <cmath>      // for less
 #include <functional> // for bind2nd
+#include <limits>
 #include <numeric>
 
 // Includes from libnestutil:
@@ -48,6 +49,7 @@ nest::correlomatrix_detector::Parameters_::Parameters_()
   , Tstart_( Time::ms( 0.0 ) )
   , Tstop_( Time::pos_inf() )
   , N_channels_( 1 )
+  , binned_( false )
 {
 }
 
@@ -57,6 +59,7 @@ nest::correlomatrix_detector::Parameters_::Parameters_( const Parameters_& p )
   , Tstart_( p.Tstart_ )
   , Tstop_( p.Tstop_ )
   , N_channels_( p.N_channels_ )
+  , binned_( p.binned_ )
 {
   // Check for proper properties is not done here but in the
   // correlomatrix_detector() copy c'tor. The check cannot be
@@ -91,6 +94,7 @@ nest::correlomatrix_detector::Parameters_::get( DictionaryDatum& d ) const
   ( *d )[ names::Tstart ] = Tstart_.get_ms();
   ( *d )[ names::Tstop ] = Tstop_.get_ms();
   ( *d )[ names::N_channels ] = N_channels_;
+  ( *d )[ names::binned ] = binned_;
 }
 
 void
@@ -160,6 +164,13 @@ nest::correlomatrix_detector::Parameters_::set( const DictionaryDatum& d, const
     reset = true;
   }
 
+  bool binned = binned_;
+  if ( updateValueParam< bool >( d, names::binned, binned, node ) and binned != binned_ )
+  {
+    binned_ = binned;
+    reset = true;
+  }
+
   if ( not delta_tau_.is_step() )
   {
     throw StepMultipleRequired( n.get_name(), names::delta_tau, delta_tau_ );
@@ -209,6 +220,74 @@ nest::correlomatrix_detector::State_::reset( const Parameters_& p )
       count_covariance_[ i ][ j ].resize( 1 + p.tau_max_.get_steps() / p.delta_tau_.get_steps(), 0 );
     }
   }
+
+  if ( p.binned_ )
+  {
+    // lags of pairs in the covariances are in [0, tau_max+delta_tau/2)
+    const long max_lag = p.tau_max_.get_steps() + p.delta_tau_.get_steps() / 2;
+    // pairs are counted if the later spike lies in [Tstart, Tstop]
+    const long count_from = p.Tstart_.get_steps();
+    const long count_until = p.Tstop_.is_finite() ? p.Tstop_.get_steps() + ( p.Tstop_.is_step() ? 1 : 0 )
+                                                  : std::numeric_limits< long >::max();
+    correlator_.reset( p.N_channels_, max_lag, count_from, count_until );
+  }
+  else
+  {
+    correlator_.reset( 1, 0, 0, 0 );
+  }
+}
+
+void
+nest::correlomatrix_detector::State_::update_covariances( const Parameters_& p )
+{
+  const long delta_tau = p.delta_tau_.get_steps();
+  const long max_lag = p.tau_max_.get_steps() + delta_tau / 2;
+  for ( long a = 0; a < p.N_channels_; ++a )
+  {
+    for ( long b = 0; b < p.N_channels_; ++b )
+    {
+      std::fill( covariance_[ a ][ b ].begin(), covariance_[ a ][ b ].end(), 0. );
+      std::fill( count_covariance_[ a ][ b ].begin(), count_covariance_[ a ][ b ].end(), 0 );
+    }
+  }
+
+  for ( long a = 0; a < p.N_channels_; ++a )
+  {
+    for ( long b = 0; b < p.N_channels_; ++b )
+    {
+      // pairs with the spike of channel a later by lag > 0, binned as in
+      // handle(); the zero bin is symmetric
+      for ( long lag = 1; lag <= max_lag; ++lag )
+      {
+        const size_t bin = ( lag + delta_tau / 2 ) / delta_tau;
+        const double weighted = correlator_.get_weighted( a, b, lag );
+        const long count = correlator_.get_count( a, b, lag );
+        covariance_[ a ][ b ][ bin ] += weighted;
+        count_covariance_[ a ][ b ][ bin ] += count;
+        if ( bin == 0 )
+        {
+          covariance_[ b ][ a ][ bin ] += weighted;
+          count_covariance_[ b ][ a ][ bin ] += count;
+        }
+      }
+    }
+
+    // simultaneous pairs of different channels enter both zero bins
+    for ( long b = a + 1; b < p.N_channels_; ++b )
+    {
+      const double weighted = correlator_.get_weighted( a, b, 0 );
+      const long count = correlator_.get_count( a, b, 0 );
+      covariance_[ a ][ b ][ 0 ] += weighted;
+      covariance_[ b ][ a ][ 0 ] += weighted;
+      count_covariance_[ a ][ b ][ 0 ] += count;
+      count_covariance_[ b ][ a ][ 0 ] += count;
+    }
+
+    // simultaneous pairs of one channel are counted once, each spike is
+    // paired with itself
+    covariance_[ a ][ a ][ 0 ] += 0.5 * ( correlator_.get_weighted( a, a, 0 ) + correlator_.get_weighted_squares( a ) );
+    count_covariance_[ a ][ a ][ 0 ] += ( correlator_.get_count( a, a, 0 ) + correlator_.get_count_squares( a ) ) / 2;
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -273,8 +352,35 @@ nest::correlomatrix_detector::calibrate()
  * ---------------------------------------------------------------- */
 
 void
-nest::correlomatrix_detector::update( Time const&, const long, const long )
+nest::correlomatrix_detector::update( Time const& origin, const long, const long )
+{
+  if ( P_.binned_ )
+  {
+    // with the pipelined spike exchange, the spikes of the previous slice
+    // may still be pending, so only the spikes up to its origin are complete
+    const long complete_until = origin.get_steps() - kernel().connection_manager.get_min_delay() + 1;
+    if ( complete_until - S_.correlator_.get_processed_until() >= S_.correlator_.get_block_size() )
+    {
+      process_binned_( complete_until );
+    }
+  }
+}
+
+void
+nest::correlomatrix_detector::post_run_cleanup()
+{
+  if ( P_.binned_ )
+  {
+    // all spikes up to the end of the last complete slice have been delivered
+    process_binned_( kernel().simulation_manager.get_clock().get_steps() + 1 );
+  }
+}
+
+void
+nest::correlomatrix_detector::process_binned_( long until )
 {
+  S_.correlator_.process( until );
+  S_.update_covariances( P_ );
 }
 
 void
@@ -293,6 +399,17 @@ nest::correlomatrix_detector::handle( SpikeEvent& e )
 
   if ( device_.is_active( stamp ) )
   {
+    if ( P_.binned_ )
+    {
+      // the pairs are counted block-wise in update()
+      if ( P_.Tstart_ <= stamp && stamp <= P_.Tstop_ )
+      {
+        S_.n_events_[ sender ]++;
+      }
+      S_.correlator_.add( sender, stamp.get_steps(), e.get_weight(), e.get_multiplicity() );
+      return;
+    }
+
     const long spike_i = stamp.get_steps();
 
     // find first appearence of element which is greater than spike_i
@@ -28,6 +28,9 @@
 #include <deque>
 #include <vector>
 
+// Includes from libnestutil:
+#include "binned_correlator.h"
+
 // Includes from nestkernel:
 #include "event.h"
 #include "nest_timeconverter.h"
@@ -130,8 +133,30 @@ count_covariance 3D        matrix of read-only -raw, auto/cross correlation
                  integers
 n_events         list of   number of events from all sources
                  integers
+binned           boolean   Compute the covariances block-wise from the binned
+                           spike trains (see below). Default is false.
+                           Setting binned clears count_covariance, covariance
+                           and n_events.
 ================ ========= ====================================================
 
+Binned mode:
+
+If binned is true, handle() only adds each spike to the spike counts of
+its channel per simulation step. Blocks of steps are correlated with
+each other and with the preceding tau_max+delta_tau/2 with a fast Fourier
+transform for all pairs of channels, so that the cost per block grows
+with its length L as L log(L) instead of with the number of spike pairs.
+This pays off for high rates and long tau_max. The covariances are
+updated after each block and at the end of each call to Run, where the
+last block is completed. Pairs of spikes are counted if the later of the
+two spikes lies in [Tstart, Tstop].
+
+For spikes of multiplicity one, count_covariance is identical to the one
+computed spike by spike and covariance equals it up to rounding errors.
+A spike of multiplicity m counts as m spikes in both matrices, while the
+spike-by-spike computation weights the count of a pair with the
+multiplicity of the spike arriving later.
+
 Receives
 ++++++++
 
@@ -184,6 +209,11 @@ public:
 
   void calibrate_time( const TimeConverter& tc );
 
+  /**
+   * Complete the covariances of the binned mode.
+   */
+  void post_run_cleanup();
+
 private:
   void init_state_( Node const& );
   void init_buffers_();
@@ -191,6 +221,12 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Process the binned spike trains up to the given step and update the
+   * covariances.
+   */
+  void process_binned_( long until );
+
   // ------------------------------------------------------------
 
   /**
@@ -232,6 +268,7 @@ private:
     Time Tstart_;     //!< start of recording
     Time Tstop_;      //!< end of recording
     long N_channels_; //!< number of channels
+    bool binned_;     //!< correlate binned spike trains block-wise
 
     Parameters_();                     //!< Sets default parameter values
     Parameters_( const Parameters_& ); //!< Recalibrate all times
@@ -270,6 +307,9 @@ private:
      */
     std::vector< std::vector< std::vector< long > > > count_covariance_;
 
+    //! Correlations of the binned spike trains in binned mode
+    BinnedCorrelator correlator_;
+
     State_(); //!< initialize default state
 
     void get( DictionaryDatum& ) const;
@@ -280,6 +320,9 @@ private:
     void set( const DictionaryDatum&, const Parameters_&, bool, Node* node );
 
     void reset( const Parameters_& );
+
+    //! Compute the covariances from the correlations of the binned spike trains
+    void update_covariances( const Parameters_& );
   };
 
   // ------------------------------------------------------------
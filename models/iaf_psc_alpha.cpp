@@ -31,6 +31,7 @@
 #include "propagator_stability.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "universal_data_logger_impl.h"
@@ -254,6 +255,39 @@ iaf_psc_alpha::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+iaf_psc_alpha::write_checkpoint( std::ostream& os ) const
+{
+  Archiving_Node::write_checkpoint( os );
+  write_checkpoint_value( os, S_ );
+  B_.ex_spikes_.write_checkpoint( os );
+  B_.in_spikes_.write_checkpoint( os );
+  B_.currents_.write_checkpoint( os );
+}
+
+void
+iaf_psc_alpha::read_checkpoint( std::istream& is )
+{
+  Archiving_Node::read_checkpoint( is );
+  read_checkpoint_value( is, S_ );
+  B_.ex_spikes_.read_checkpoint( is );
+  B_.in_spikes_.read_checkpoint( is );
+  B_.currents_.read_checkpoint( is );
+}
+
+size_t
+iaf_psc_alpha::get_buffer_memory() const
+{
+  return Archiving_Node::get_buffer_memory()
+    + ( B_.ex_spikes_.size() + B_.in_spikes_.size() + B_.currents_.size() ) * sizeof( double );
+}
+
+size_t
+iaf_psc_alpha::get_buffer_memory_forecast() const
+{
+  return Archiving_Node::get_buffer_memory() + 3 * RingBuffer::get_memory_forecast();
+}
+
 void
 iaf_psc_alpha::calibrate()
 {
@@ -411,4 +445,158 @@ iaf_psc_alpha::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
+/* ----------------------------------------------------------------
+ * Population engine
+ * ---------------------------------------------------------------- */
+
+PopulationEngine*
+iaf_psc_alpha::create_population_engine() const
+{
+  return new PopulationEngine_();
+}
+
+bool
+iaf_psc_alpha::PopulationEngine_::add_node( Node& node )
+{
+  iaf_psc_alpha& n = dynamic_cast< iaf_psc_alpha& >( node );
+
+  if ( n.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( nodes_.size() );
+  }
+  nodes_.push_back( &n );
+
+  y0_.push_back( n.S_.y0_ );
+  dI_ex_.push_back( n.S_.dI_ex_ );
+  I_ex_.push_back( n.S_.I_ex_ );
+  dI_in_.push_back( n.S_.dI_in_ );
+  I_in_.push_back( n.S_.I_in_ );
+  y3_.push_back( n.S_.y3_ );
+  r_.push_back( n.S_.r_ );
+
+  weighted_spikes_ex_.push_back( n.V_.weighted_spikes_ex_ );
+  weighted_spikes_in_.push_back( n.V_.weighted_spikes_in_ );
+
+  I_e_.push_back( n.P_.I_e_ );
+  Theta_.push_back( n.P_.Theta_ );
+  V_reset_.push_back( n.P_.V_reset_ );
+  LowerBound_.push_back( n.P_.LowerBound_ );
+  EPSCInitialValue_.push_back( n.V_.EPSCInitialValue_ );
+  IPSCInitialValue_.push_back( n.V_.IPSCInitialValue_ );
+  RefractoryCounts_.push_back( n.V_.RefractoryCounts_ );
+  P11_ex_.push_back( n.V_.P11_ex_ );
+  P21_ex_.push_back( n.V_.P21_ex_ );
+  P22_ex_.push_back( n.V_.P22_ex_ );
+  P31_ex_.push_back( n.V_.P31_ex_ );
+  P32_ex_.push_back( n.V_.P32_ex_ );
+  P11_in_.push_back( n.V_.P11_in_ );
+  P21_in_.push_back( n.V_.P21_in_ );
+  P22_in_.push_back( n.V_.P22_in_ );
+  P31_in_.push_back( n.V_.P31_in_ );
+  P32_in_.push_back( n.V_.P32_in_ );
+  P30_.push_back( n.V_.P30_ );
+  expm1_tau_m_.push_back( n.V_.expm1_tau_m_ );
+
+  return true;
+}
+
+void
+iaf_psc_alpha::PopulationEngine_::update( Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t num_nodes = nodes_.size();
+  std::vector< size_t >::const_iterator logged = logged_.begin();
+
+  for ( size_t begin = 0; begin < num_nodes; begin += block_size_ )
+  {
+    const size_t end = begin + block_size_ < num_nodes ? begin + block_size_ : num_nodes;
+    const std::vector< size_t >::const_iterator logged_begin = logged;
+    while ( logged != logged_.end() and *logged < end )
+    {
+      ++logged;
+    }
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      for ( size_t i = begin; i < end; ++i )
+      {
+        weighted_spikes_ex_[ i ] = nodes_[ i ]->B_.ex_spikes_.get_value( lag );
+        weighted_spikes_in_[ i ] = nodes_[ i ]->B_.in_spikes_.get_value( lag );
+      }
+
+      for ( size_t i = begin; i < end; ++i )
+      {
+        // membrane potential of neurons that are not refractory
+        const double y3 = P30_[ i ] * ( y0_[ i ] + I_e_[ i ] ) + P31_ex_[ i ] * dI_ex_[ i ] + P32_ex_[ i ] * I_ex_[ i ]
+          + P31_in_[ i ] * dI_in_[ i ] + P32_in_[ i ] * I_in_[ i ] + expm1_tau_m_[ i ] * y3_[ i ] + y3_[ i ];
+        const double y3_bounded = y3 < LowerBound_[ i ] ? LowerBound_[ i ] : y3;
+
+        y3_[ i ] = r_[ i ] == 0 ? y3_bounded : y3_[ i ];
+        r_[ i ] = r_[ i ] == 0 ? 0 : r_[ i ] - 1;
+
+        // alpha shape PSCs
+        I_ex_[ i ] = P21_ex_[ i ] * dI_ex_[ i ] + P22_ex_[ i ] * I_ex_[ i ];
+        dI_ex_[ i ] *= P11_ex_[ i ];
+        dI_ex_[ i ] += EPSCInitialValue_[ i ] * weighted_spikes_ex_[ i ];
+
+        I_in_[ i ] = P21_in_[ i ] * dI_in_[ i ] + P22_in_[ i ] * I_in_[ i ];
+        dI_in_[ i ] *= P11_in_[ i ];
+        dI_in_[ i ] += IPSCInitialValue_[ i ] * weighted_spikes_in_[ i ];
+      }
+
+      // threshold crossing
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( y3_[ i ] >= Theta_[ i ] )
+        {
+          r_[ i ] = RefractoryCounts_[ i ];
+          y3_[ i ] = V_reset_[ i ];
+
+          nodes_[ i ]->set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+          SpikeEvent se;
+          kernel().event_delivery_manager.send( *nodes_[ i ], se, lag );
+        }
+      }
+
+      // set new input current
+      for ( size_t i = begin; i < end; ++i )
+      {
+        y0_[ i ] = nodes_[ i ]->B_.currents_.get_value( lag );
+      }
+
+      // log state data; the logger reads the state from the node
+      for ( std::vector< size_t >::const_iterator it = logged_begin; it != logged; ++it )
+      {
+        iaf_psc_alpha& n = *nodes_[ *it ];
+        n.S_.I_ex_ = I_ex_[ *it ];
+        n.S_.I_in_ = I_in_[ *it ];
+        n.S_.y3_ = y3_[ *it ];
+        n.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ *it ];
+        n.V_.weighted_spikes_in_ = weighted_spikes_in_[ *it ];
+        n.B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
+  }
+}
+
+void
+iaf_psc_alpha::PopulationEngine_::release_nodes()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    iaf_psc_alpha& n = *nodes_[ i ];
+    n.S_.y0_ = y0_[ i ];
+    n.S_.dI_ex_ = dI_ex_[ i ];
+    n.S_.I_ex_ = I_ex_[ i ];
+    n.S_.dI_in_ = dI_in_[ i ];
+    n.S_.I_in_ = I_in_[ i ];
+    n.S_.y3_ = y3_[ i ];
+    n.S_.r_ = r_[ i ];
+    n.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ i ];
+    n.V_.weighted_spikes_in_ = weighted_spikes_in_[ i ];
+  }
+}
+
 } // namespace
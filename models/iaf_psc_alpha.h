@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_ALPHA_H
 #define IAF_PSC_ALPHA_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -175,6 +179,13 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  PopulationEngine* create_population_engine() const;
+
+  void write_checkpoint( std::ostream& ) const;
+  void read_checkpoint( std::istream& );
+  size_t get_buffer_memory() const;
+  size_t get_buffer_memory_forecast() const;
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -182,6 +193,8 @@ private:
 
   void update( Time const&, const long, const long );
 
+  class PopulationEngine_;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
@@ -306,6 +319,62 @@ private:
     double weighted_spikes_in_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Updates all thread-local iaf_psc_alpha neurons together.
+   *
+   * State variables and the constants of the update are held in one array
+   * per quantity. The arithmetic of each step runs as a loop over these
+   * arrays without branches and in the same order of operations as
+   * iaf_psc_alpha::update(), so that results are identical.
+   */
+  class PopulationEngine_ : public PopulationEngine
+  {
+  public:
+    bool add_node( Node& );
+    void update( Time const&, const long, const long );
+    void release_nodes();
+
+  private:
+    std::vector< iaf_psc_alpha* > nodes_;
+    std::vector< size_t > logged_; //!< Indices of nodes recorded by multimeters
+
+    // state, see State_
+    std::vector< double > y0_;
+    std::vector< double > dI_ex_;
+    std::vector< double > I_ex_;
+    std::vector< double > dI_in_;
+    std::vector< double > I_in_;
+    std::vector< double > y3_;
+    std::vector< int > r_;
+
+    // input of the current step, see Variables_
+    std::vector< double > weighted_spikes_ex_;
+    std::vector< double > weighted_spikes_in_;
+
+    // parameters and propagators, see Parameters_ and Variables_
+    std::vector< double > I_e_;
+    std::vector< double > Theta_;
+    std::vector< double > V_reset_;
+    std::vector< double > LowerBound_;
+    std::vector< double > EPSCInitialValue_;
+    std::vector< double > IPSCInitialValue_;
+    std::vector< int > RefractoryCounts_;
+    std::vector< double > P11_ex_;
+    std::vector< double > P21_ex_;
+    std::vector< double > P22_ex_;
+    std::vector< double > P31_ex_;
+    std::vector< double > P32_ex_;
+    std::vector< double > P11_in_;
+    std::vector< double > P21_in_;
+    std::vector< double > P22_in_;
+    std::vector< double > P31_in_;
+    std::vector< double > P32_in_;
+    std::vector< double > P30_;
+    std::vector< double > expm1_tau_m_;
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
@@ -32,6 +32,7 @@
 #include "numerics.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "universal_data_logger_impl.h"
@@ -236,6 +237,36 @@ nest::iaf_psc_delta::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+nest::iaf_psc_delta::write_checkpoint( std::ostream& os ) const
+{
+  Archiving_Node::write_checkpoint( os );
+  write_checkpoint_value( os, S_ );
+  B_.spikes_.write_checkpoint( os );
+  B_.currents_.write_checkpoint( os );
+}
+
+void
+nest::iaf_psc_delta::read_checkpoint( std::istream& is )
+{
+  Archiving_Node::read_checkpoint( is );
+  read_checkpoint_value( is, S_ );
+  B_.spikes_.read_checkpoint( is );
+  B_.currents_.read_checkpoint( is );
+}
+
+size_t
+nest::iaf_psc_delta::get_buffer_memory() const
+{
+  return Archiving_Node::get_buffer_memory() + ( B_.spikes_.size() + B_.currents_.size() ) * sizeof( double );
+}
+
+size_t
+nest::iaf_psc_delta::get_buffer_memory_forecast() const
+{
+  return Archiving_Node::get_buffer_memory() + 2 * RingBuffer::get_memory_forecast();
+}
+
 void
 nest::iaf_psc_delta::calibrate()
 {
@@ -368,4 +399,124 @@ nest::iaf_psc_delta::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
+/* ----------------------------------------------------------------
+ * Population engine
+ * ---------------------------------------------------------------- */
+
+nest::PopulationEngine*
+nest::iaf_psc_delta::create_population_engine() const
+{
+  return new PopulationEngine_();
+}
+
+bool
+nest::iaf_psc_delta::PopulationEngine_::add_node( Node& node )
+{
+  iaf_psc_delta& n = dynamic_cast< iaf_psc_delta& >( node );
+
+  if ( n.P_.with_refr_input_ )
+  {
+    return false;
+  }
+
+  if ( n.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( nodes_.size() );
+  }
+  nodes_.push_back( &n );
+
+  y0_.push_back( n.S_.y0_ );
+  y3_.push_back( n.S_.y3_ );
+  r_.push_back( n.S_.r_ );
+  spikes_.push_back( 0.0 );
+
+  I_e_.push_back( n.P_.I_e_ );
+  V_th_.push_back( n.P_.V_th_ );
+  V_min_.push_back( n.P_.V_min_ );
+  V_reset_.push_back( n.P_.V_reset_ );
+  RefractoryCounts_.push_back( n.V_.RefractoryCounts_ );
+  P30_.push_back( n.V_.P30_ );
+  P33_.push_back( n.V_.P33_ );
+
+  return true;
+}
+
+void
+nest::iaf_psc_delta::PopulationEngine_::update( Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t num_nodes = nodes_.size();
+  std::vector< size_t >::const_iterator logged = logged_.begin();
+
+  for ( size_t begin = 0; begin < num_nodes; begin += block_size_ )
+  {
+    const size_t end = begin + block_size_ < num_nodes ? begin + block_size_ : num_nodes;
+    const std::vector< size_t >::const_iterator logged_begin = logged;
+    while ( logged != logged_.end() and *logged < end )
+    {
+      ++logged;
+    }
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      // spikes arriving during the refractory period are read and ignored
+      for ( size_t i = begin; i < end; ++i )
+      {
+        spikes_[ i ] = nodes_[ i ]->B_.spikes_.get_value( lag );
+      }
+
+      for ( size_t i = begin; i < end; ++i )
+      {
+        const double y3 = P30_[ i ] * ( y0_[ i ] + I_e_[ i ] ) + P33_[ i ] * y3_[ i ] + spikes_[ i ];
+        const double y3_bounded = y3 < V_min_[ i ] ? V_min_[ i ] : y3;
+
+        y3_[ i ] = r_[ i ] == 0 ? y3_bounded : y3_[ i ];
+        r_[ i ] = r_[ i ] == 0 ? 0 : r_[ i ] - 1;
+      }
+
+      // threshold crossing
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( y3_[ i ] >= V_th_[ i ] )
+        {
+          r_[ i ] = RefractoryCounts_[ i ];
+          y3_[ i ] = V_reset_[ i ];
+
+          nodes_[ i ]->set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+          SpikeEvent se;
+          kernel().event_delivery_manager.send( *nodes_[ i ], se, lag );
+        }
+      }
+
+      // set new input current
+      for ( size_t i = begin; i < end; ++i )
+      {
+        y0_[ i ] = nodes_[ i ]->B_.currents_.get_value( lag );
+      }
+
+      // voltage logging; the logger reads the state from the node
+      for ( std::vector< size_t >::const_iterator it = logged_begin; it != logged; ++it )
+      {
+        iaf_psc_delta& n = *nodes_[ *it ];
+        n.S_.y3_ = y3_[ *it ];
+        n.B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
+  }
+}
+
+void
+nest::iaf_psc_delta::PopulationEngine_::release_nodes()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    iaf_psc_delta& n = *nodes_[ i ];
+    n.S_.y0_ = y0_[ i ];
+    n.S_.y3_ = y3_[ i ];
+    n.S_.r_ = r_[ i ];
+  }
+}
+
 } // namespace
@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_DELTA_H
 #define IAF_PSC_DELTA_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
 
@@ -171,6 +175,13 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  PopulationEngine* create_population_engine() const;
+
+  void write_checkpoint( std::ostream& ) const;
+  void read_checkpoint( std::istream& );
+  size_t get_buffer_memory() const;
+  size_t get_buffer_memory_forecast() const;
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -178,6 +189,8 @@ private:
 
   void update( Time const&, const long, const long );
 
+  class PopulationEngine_;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
@@ -290,6 +303,45 @@ private:
     int RefractoryCounts_;
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Updates all thread-local iaf_psc_delta neurons together.
+   *
+   * State variables and the constants of the update are held in one array
+   * per quantity and advanced in branch-free loops with the same order of
+   * operations as iaf_psc_delta::update(). Neurons with refractory_input
+   * set are not accepted and are updated individually.
+   */
+  class PopulationEngine_ : public PopulationEngine
+  {
+  public:
+    bool add_node( Node& );
+    void update( Time const&, const long, const long );
+    void release_nodes();
+
+  private:
+    std::vector< iaf_psc_delta* > nodes_;
+    std::vector< size_t > logged_; //!< Indices of nodes recorded by multimeters
+
+    // state, see State_
+    std::vector< double > y0_;
+    std::vector< double > y3_;
+    std::vector< int > r_;
+
+    //! input of the current step
+    std::vector< double > spikes_;
+
+    // parameters and propagators, see Parameters_ and Variables_
+    std::vector< double > I_e_;
+    std::vector< double > V_th_;
+    std::vector< double > V_min_;
+    std::vector< double > V_reset_;
+    std::vector< int > RefractoryCounts_;
+    std::vector< double > P30_;
+    std::vector< double > P33_;
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
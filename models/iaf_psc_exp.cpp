@@ -31,6 +31,7 @@
 #include "propagator_stability.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
@@ -250,6 +251,53 @@ nest::iaf_psc_exp::init_buffers_()
   Archiving_Node::clear_history();
 }
 
+void
+nest::iaf_psc_exp::write_checkpoint( std::ostream& os ) const
+{
+  Archiving_Node::write_checkpoint( os );
+  write_checkpoint_value( os, S_ );
+  B_.spikes_ex_.write_checkpoint( os );
+  B_.spikes_in_.write_checkpoint( os );
+  write_checkpoint_value( os, B_.currents_.size() );
+  for ( size_t i = 0; i < B_.currents_.size(); ++i )
+  {
+    B_.currents_[ i ].write_checkpoint( os );
+  }
+}
+
+void
+nest::iaf_psc_exp::read_checkpoint( std::istream& is )
+{
+  Archiving_Node::read_checkpoint( is );
+  read_checkpoint_value( is, S_ );
+  B_.spikes_ex_.read_checkpoint( is );
+  B_.spikes_in_.read_checkpoint( is );
+  size_t n_currents;
+  read_checkpoint_value( is, n_currents );
+  B_.currents_.resize( n_currents );
+  for ( size_t i = 0; i < n_currents; ++i )
+  {
+    B_.currents_[ i ].read_checkpoint( is );
+  }
+}
+
+size_t
+nest::iaf_psc_exp::get_buffer_memory() const
+{
+  size_t num_elements = B_.spikes_ex_.size() + B_.spikes_in_.size();
+  for ( const auto& currents : B_.currents_ )
+  {
+    num_elements += currents.size();
+  }
+  return Archiving_Node::get_buffer_memory() + num_elements * sizeof( double );
+}
+
+size_t
+nest::iaf_psc_exp::get_buffer_memory_forecast() const
+{
+  return Archiving_Node::get_buffer_memory() + ( 2 + B_.currents_.size() ) * RingBuffer::get_memory_forecast();
+}
+
 void
 nest::iaf_psc_exp::calibrate()
 {
@@ -408,3 +456,153 @@ nest::iaf_psc_exp::handle( DataLoggingRequest& e )
 {
   B_.logger_.handle( e );
 }
+
+/* ----------------------------------------------------------------
+ * Population engine
+ * ---------------------------------------------------------------- */
+
+nest::PopulationEngine*
+nest::iaf_psc_exp::create_population_engine() const
+{
+  return new PopulationEngine_();
+}
+
+bool
+nest::iaf_psc_exp::PopulationEngine_::add_node( Node& node )
+{
+  iaf_psc_exp& n = dynamic_cast< iaf_psc_exp& >( node );
+
+  // only the deterministic threshold, see iaf_psc_exp::update()
+  if ( not( n.P_.delta_ < 1e-10 ) )
+  {
+    return false;
+  }
+
+  if ( n.B_.logger_.has_loggers() )
+  {
+    logged_.push_back( nodes_.size() );
+  }
+  nodes_.push_back( &n );
+
+  i_0_.push_back( n.S_.i_0_ );
+  i_1_.push_back( n.S_.i_1_ );
+  i_syn_ex_.push_back( n.S_.i_syn_ex_ );
+  i_syn_in_.push_back( n.S_.i_syn_in_ );
+  V_m_.push_back( n.S_.V_m_ );
+  r_ref_.push_back( n.S_.r_ref_ );
+
+  weighted_spikes_ex_.push_back( n.V_.weighted_spikes_ex_ );
+  weighted_spikes_in_.push_back( n.V_.weighted_spikes_in_ );
+
+  I_e_.push_back( n.P_.I_e_ );
+  Theta_.push_back( n.P_.Theta_ );
+  V_reset_.push_back( n.P_.V_reset_ );
+  RefractoryCounts_.push_back( n.V_.RefractoryCounts_ );
+  P20_.push_back( n.V_.P20_ );
+  P11ex_.push_back( n.V_.P11ex_ );
+  P11in_.push_back( n.V_.P11in_ );
+  P21ex_.push_back( n.V_.P21ex_ );
+  P21in_.push_back( n.V_.P21in_ );
+  P22_.push_back( n.V_.P22_ );
+
+  return true;
+}
+
+void
+nest::iaf_psc_exp::PopulationEngine_::update( const Time& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t num_nodes = nodes_.size();
+  std::vector< size_t >::const_iterator logged = logged_.begin();
+
+  for ( size_t begin = 0; begin < num_nodes; begin += block_size_ )
+  {
+    const size_t end = begin + block_size_ < num_nodes ? begin + block_size_ : num_nodes;
+    const std::vector< size_t >::const_iterator logged_begin = logged;
+    while ( logged != logged_.end() and *logged < end )
+    {
+      ++logged;
+    }
+
+    for ( long lag = from; lag < to; ++lag )
+    {
+      for ( size_t i = begin; i < end; ++i )
+      {
+        weighted_spikes_ex_[ i ] = nodes_[ i ]->B_.spikes_ex_.get_value( lag );
+        weighted_spikes_in_[ i ] = nodes_[ i ]->B_.spikes_in_.get_value( lag );
+      }
+
+      for ( size_t i = begin; i < end; ++i )
+      {
+        // evolve V of neurons that are not refractory
+        const double V_m = V_m_[ i ] * P22_[ i ] + i_syn_ex_[ i ] * P21ex_[ i ] + i_syn_in_[ i ] * P21in_[ i ]
+          + ( I_e_[ i ] + i_0_[ i ] ) * P20_[ i ];
+
+        V_m_[ i ] = r_ref_[ i ] == 0 ? V_m : V_m_[ i ];
+        r_ref_[ i ] = r_ref_[ i ] == 0 ? 0 : r_ref_[ i ] - 1;
+
+        // exponential decaying PSCs
+        i_syn_ex_[ i ] *= P11ex_[ i ];
+        i_syn_in_[ i ] *= P11in_[ i ];
+
+        // add evolution of presynaptic input current
+        i_syn_ex_[ i ] += ( 1. - P11ex_[ i ] ) * i_1_[ i ];
+
+        i_syn_ex_[ i ] += weighted_spikes_ex_[ i ];
+        i_syn_in_[ i ] += weighted_spikes_in_[ i ];
+      }
+
+      // deterministic threshold crossing
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( V_m_[ i ] >= Theta_[ i ] )
+        {
+          r_ref_[ i ] = RefractoryCounts_[ i ];
+          V_m_[ i ] = V_reset_[ i ];
+
+          nodes_[ i ]->set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+          SpikeEvent se;
+          kernel().event_delivery_manager.send( *nodes_[ i ], se, lag );
+        }
+      }
+
+      // set new input current
+      for ( size_t i = begin; i < end; ++i )
+      {
+        i_0_[ i ] = nodes_[ i ]->B_.currents_[ 0 ].get_value( lag );
+        i_1_[ i ] = nodes_[ i ]->B_.currents_[ 1 ].get_value( lag );
+      }
+
+      // log state data; the logger reads the state from the node
+      for ( std::vector< size_t >::const_iterator it = logged_begin; it != logged; ++it )
+      {
+        iaf_psc_exp& n = *nodes_[ *it ];
+        n.S_.i_syn_ex_ = i_syn_ex_[ *it ];
+        n.S_.i_syn_in_ = i_syn_in_[ *it ];
+        n.S_.V_m_ = V_m_[ *it ];
+        n.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ *it ];
+        n.V_.weighted_spikes_in_ = weighted_spikes_in_[ *it ];
+        n.B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
+  }
+}
+
+void
+nest::iaf_psc_exp::PopulationEngine_::release_nodes()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    iaf_psc_exp& n = *nodes_[ i ];
+    n.S_.i_0_ = i_0_[ i ];
+    n.S_.i_1_ = i_1_[ i ];
+    n.S_.i_syn_ex_ = i_syn_ex_[ i ];
+    n.S_.i_syn_in_ = i_syn_in_[ i ];
+    n.S_.V_m_ = V_m_[ i ];
+    n.S_.r_ref_ = r_ref_[ i ];
+    n.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ i ];
+    n.V_.weighted_spikes_in_ = weighted_spikes_in_[ i ];
+  }
+}
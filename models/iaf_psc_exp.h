@@ -23,11 +23,15 @@
 #ifndef IAF_PSC_EXP_H
 #define IAF_PSC_EXP_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -187,6 +191,13 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  PopulationEngine* create_population_engine() const;
+
+  void write_checkpoint( std::ostream& ) const;
+  void read_checkpoint( std::istream& );
+  size_t get_buffer_memory() const;
+  size_t get_buffer_memory_forecast() const;
+
 private:
   void init_state_( const Node& proto );
   void init_buffers_();
@@ -194,6 +205,8 @@ private:
 
   void update( const Time&, const long, const long );
 
+  class PopulationEngine_;
+
   // intensity function
   double phi_() const;
 
@@ -331,6 +344,52 @@ private:
     librandom::RngPtr rng_; //!< random number generator of my own thread
   };
 
+  // ----------------------------------------------------------------
+
+  /**
+   * Updates all thread-local iaf_psc_exp neurons together.
+   *
+   * State variables and the constants of the update are held in one array
+   * per quantity and advanced in branch-free loops with the same order of
+   * operations as iaf_psc_exp::update(). Neurons with stochastic threshold
+   * are not accepted and are updated individually.
+   */
+  class PopulationEngine_ : public PopulationEngine
+  {
+  public:
+    bool add_node( Node& );
+    void update( Time const&, const long, const long );
+    void release_nodes();
+
+  private:
+    std::vector< iaf_psc_exp* > nodes_;
+    std::vector< size_t > logged_; //!< Indices of nodes recorded by multimeters
+
+    // state, see State_
+    std::vector< double > i_0_;
+    std::vector< double > i_1_;
+    std::vector< double > i_syn_ex_;
+    std::vector< double > i_syn_in_;
+    std::vector< double > V_m_;
+    std::vector< int > r_ref_;
+
+    // input of the current step, see Variables_
+    std::vector< double > weighted_spikes_ex_;
+    std::vector< double > weighted_spikes_in_;
+
+    // parameters and propagators, see Parameters_ and Variables_
+    std::vector< double > I_e_;
+    std::vector< double > Theta_;
+    std::vector< double > V_reset_;
+    std::vector< int > RefractoryCounts_;
+    std::vector< double > P20_;
+    std::vector< double > P11ex_;
+    std::vector< double > P11in_;
+    std::vector< double > P21ex_;
+    std::vector< double > P21in_;
+    std::vector< double > P22_;
+  };
+
   // Access functions for UniversalDataLogger -------------------------------
 
   //! Read out the real membrane potential
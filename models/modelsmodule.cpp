@@ -92,6 +92,7 @@
 #include "pulsepacket_generator.h"
 #include "sinusoidal_gamma_generator.h"
 #include "sinusoidal_poisson_generator.h"
+#include "spike_file_generator.h"
 #include "spike_generator.h"
 #include "step_current_generator.h"
 #include "step_rate_generator.h"
@@ -228,6 +229,7 @@ ModelsModule::init( SLIInterpreter* )
   kernel().model_manager.register_node_model< ac_generator >( "ac_generator" );
   kernel().model_manager.register_node_model< dc_generator >( "dc_generator" );
   kernel().model_manager.register_node_model< spike_generator >( "spike_generator" );
+  kernel().model_manager.register_node_model< spike_file_generator >( "spike_file_generator" );
   kernel().model_manager.register_node_model< inhomogeneous_poisson_generator >( "inhomogeneous_poisson_generator" );
   kernel().model_manager.register_node_model< poisson_generator >( "poisson_generator" );
   kernel().model_manager.register_node_model< pulsepacket_generator >( "pulsepacket_generator" );
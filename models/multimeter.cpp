@@ -22,6 +22,10 @@
 
 #include "multimeter.h"
 
+// C++ includes:
+#include <algorithm>
+#include <limits>
+
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
 
@@ -54,6 +58,14 @@ multimeter::send_test_event( Node& target, rport receptor_type, synindex, bool )
   if ( p != invalid_port_ and not is_model_prototype() )
   {
     B_.has_targets_ = true;
+
+    // Targets are selected on the thread of the target, which is the thread
+    // of this instance, so the random number generator of the thread is used.
+    if ( P_.record_fraction_ < 1.0 and B_.sampled_targets_.find( target.get_node_id() ) == B_.sampled_targets_.end()
+      and kernel().rng_manager.get_rng( get_thread() )->drand() < P_.record_fraction_ )
+    {
+      B_.sampled_targets_.insert( target.get_node_id() );
+    }
   }
   return p;
 }
@@ -62,6 +74,8 @@ nest::multimeter::Parameters_::Parameters_()
   : interval_( Time::ms( 1.0 ) )
   , offset_( Time::ms( 0. ) )
   , record_from_()
+  , aggregate_( false )
+  , record_fraction_( 1.0 )
 {
 }
 
@@ -69,13 +83,37 @@ nest::multimeter::Parameters_::Parameters_( const Parameters_& p )
   : interval_( p.interval_ )
   , offset_( p.offset_ )
   , record_from_( p.record_from_ )
+  , aggregate_( p.aggregate_ )
+  , record_fraction_( p.record_fraction_ )
 {
   interval_.calibrate();
 }
 
 nest::multimeter::Buffers_::Buffers_()
   : has_targets_( false )
+  , sampled_targets_()
+  , statistics_()
+{
+}
+
+nest::multimeter::Buffers_::Statistics::Statistics()
+  : n( 0 )
+  , mean( 0.0 )
+  , m2( 0.0 )
+  , min( std::numeric_limits< double >::infinity() )
+  , max( -std::numeric_limits< double >::infinity() )
+{
+}
+
+void
+nest::multimeter::Buffers_::Statistics::add( double value )
 {
+  ++n;
+  const double delta = value - mean;
+  mean += delta / n;
+  m2 += delta * ( value - mean );
+  min = std::min( min, value );
+  max = std::max( max, value );
 }
 
 void
@@ -89,18 +127,21 @@ nest::multimeter::Parameters_::get( DictionaryDatum& d ) const
     ad.push_back( LiteralDatum( record_from_[ j ] ) );
   }
   ( *d )[ names::record_from ] = ad;
+  ( *d )[ names::aggregate ] = aggregate_;
+  ( *d )[ names::record_fraction ] = record_fraction_;
 }
 
 void
 nest::multimeter::Parameters_::set( const DictionaryDatum& d, const Buffers_& b, Node* node )
 {
   if ( b.has_targets_
-    && ( d->known( names::interval ) || d->known( names::offset ) || d->known( names::record_from ) ) )
+    && ( d->known( names::interval ) || d->known( names::offset ) || d->known( names::record_from )
+         || d->known( names::aggregate ) || d->known( names::record_fraction ) ) )
   {
     throw BadProperty(
-      "The recording interval, the interval offset and the list of properties "
-      "to record cannot be changed after the multimeter has been connected "
-      "to nodes." );
+      "The recording interval, the interval offset, the list of properties "
+      "to record, aggregate and record_fraction cannot be changed after the "
+      "multimeter has been connected to nodes." );
   }
 
   double v;
@@ -144,6 +185,17 @@ nest::multimeter::Parameters_::set( const DictionaryDatum& d, const Buffers_& b,
     }
   }
 
+  updateValueParam< bool >( d, names::aggregate, aggregate_, node );
+
+  if ( updateValueParam< double >( d, names::record_fraction, v, node ) )
+  {
+    if ( v <= 0.0 or v > 1.0 )
+    {
+      throw BadProperty( "The fraction of targets to record from must be in (0, 1]." );
+    }
+    record_fraction_ = v;
+  }
+
   // extract data
   if ( d->known( names::record_from ) )
   {
@@ -160,7 +212,21 @@ nest::multimeter::Parameters_::set( const DictionaryDatum& d, const Buffers_& b,
 void
 multimeter::calibrate()
 {
-  RecordingDevice::calibrate( P_.record_from_, RecordingBackend::NO_LONG_VALUE_NAMES );
+  if ( not P_.aggregate_ )
+  {
+    RecordingDevice::calibrate( P_.record_from_, RecordingBackend::NO_LONG_VALUE_NAMES );
+    return;
+  }
+
+  std::vector< Name > statistics_names;
+  for ( const Name& name : P_.record_from_ )
+  {
+    statistics_names.push_back( name.toString() + "_mean" );
+    statistics_names.push_back( name.toString() + "_var" );
+    statistics_names.push_back( name.toString() + "_min" );
+    statistics_names.push_back( name.toString() + "_max" );
+  }
+  RecordingDevice::calibrate( statistics_names, std::vector< Name >( 1, names::sample_size ) );
 }
 
 void
@@ -185,11 +251,54 @@ multimeter::update( Time const& origin, const long from, const long )
   // Note that not all nodes receiving the request will necessarily answer.
   DataLoggingRequest req;
   kernel().event_delivery_manager.send( *this, req );
+
+  if ( P_.aggregate_ )
+  {
+    write_statistics_();
+  }
+}
+
+void
+multimeter::write_statistics_()
+{
+  const DataLoggingReply::Container no_data;
+  DataLoggingReply reply( no_data );
+  reply.set_sender_node_id( get_node_id() );
+
+  std::vector< double > values;
+  std::vector< long > sample_size( 1 );
+  for ( const auto& step_statistics : B_.statistics_ )
+  {
+    if ( step_statistics.second.empty() )
+    {
+      continue; // nothing is recorded
+    }
+
+    values.clear();
+    for ( const Buffers_::Statistics& stats : step_statistics.second )
+    {
+      values.push_back( stats.mean );
+      values.push_back( stats.m2 / stats.n );
+      values.push_back( stats.min );
+      values.push_back( stats.max );
+    }
+    sample_size[ 0 ] = step_statistics.second.front().n;
+
+    reply.set_stamp( Time::step( step_statistics.first ) );
+    write( reply, values, sample_size );
+  }
+  B_.statistics_.clear();
 }
 
 void
 multimeter::handle( DataLoggingReply& reply )
 {
+  if ( P_.record_fraction_ < 1.0
+    and B_.sampled_targets_.find( reply.get_sender_node_id() ) == B_.sampled_targets_.end() )
+  {
+    return;
+  }
+
   // easy access to relevant information
   DataLoggingReply::Container const& info = reply.get_info();
 
@@ -210,6 +319,17 @@ multimeter::handle( DataLoggingReply& reply )
       continue;
     }
 
+    if ( P_.aggregate_ )
+    {
+      std::vector< Buffers_::Statistics >& stats = B_.statistics_[ info[ j ].timestamp.get_steps() ];
+      stats.resize( info[ j ].data.size() );
+      for ( size_t k = 0; k < stats.size(); ++k )
+      {
+        stats[ k ].add( info[ j ].data[ k ] );
+      }
+      continue;
+    }
+
     reply.set_stamp( info[ j ].timestamp );
     // const index sender = reply.get_sender_node_id();
     // const Time stamp = reply.get_stamp();
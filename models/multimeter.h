@@ -24,6 +24,8 @@
 #define MULTIMETER_H
 
 // C++ includes:
+#include <map>
+#include <set>
 #include <vector>
 
 // Includes from nestkernel:
@@ -104,6 +106,46 @@ support the sampling of the values *V_m* and *g_ex*. It would also
 fail if carried out in the wrong direction, i.e., trying to connect the
 *neurons* to *mm*.
 
+Reducing the recorded data
+++++++++++++++++++++++++++
+
+Recording from large populations at a fine resolution produces a lot
+of data. The ``multimeter`` can reduce the data before it is passed to
+the recording backend. Temporal downsampling is controlled by the
+`interval`, since neurons only store samples at the points in time
+required by the ``multimeter``.
+
+If `record_fraction` is set to a value smaller than 1, the ``multimeter``
+records only from a random subset of the nodes it is connected to.
+Each node is selected independently with probability `record_fraction`
+when the connection is created. The selected nodes can be read from
+the property `sampled_targets`.
+
+If `aggregate` is set to *true*, the ``multimeter`` does not record the
+values of the individual nodes. Instead, it computes the mean, the
+variance, the minimum and the maximum of each recorded quantity across
+all nodes for each point in time. These statistics are recorded with the
+node ID of the ``multimeter`` as sender and the names of the quantities
+extended by ``_mean``, ``_var``, ``_min`` and ``_max``, e.g.
+``V_m_mean``. The variance is the population variance. The integer
+value ``sample_size`` holds the number of nodes contributing to the
+statistics.
+
+::
+
+   mm = nest.Create('multimeter', 1, {'record_from': ['V_m'],
+                                      'aggregate': True,
+                                      'record_fraction': 0.1})
+
+The statistics are computed separately on each thread and MPI process
+for the nodes located there, so there is one record per point in time
+for each thread that has nodes to record from. The statistics of the
+whole population can be obtained by combining these records weighted
+by ``sample_size``.
+
+Both properties have to be set before the ``multimeter`` is connected
+to any node.
+
 .. note::
 
    A pre-configured  ``multimeter`` is available under the name ``voltmeter``.  Its
@@ -174,11 +216,19 @@ protected:
 private:
   struct Buffers_;
 
+  /**
+   * Write the statistics collected across all targets during the last call
+   * to handle() and clear them.
+   */
+  void write_statistics_();
+
   struct Parameters_
   {
     Time interval_;                   //!< recording interval, in ms
     Time offset_;                     //!< offset relative to which interval is calculated, in ms
     std::vector< Name > record_from_; //!< which data to record
+    bool aggregate_;                  //!< record statistics across targets instead of individual values
+    double record_fraction_;          //!< probability with which a target is recorded from
 
     Parameters_();
     Parameters_( const Parameters_& );
@@ -198,6 +248,29 @@ private:
     Buffers_();
 
     bool has_targets_;
+
+    /**
+     * Mean, variance, minimum and maximum of one recorded quantity at a
+     * single point in time, updated one sample at a time using Welford's
+     * algorithm.
+     */
+    struct Statistics
+    {
+      Statistics();
+      void add( double value );
+
+      size_t n;
+      double mean;
+      double m2; //!< sum of squared deviations from the mean
+      double min;
+      double max;
+    };
+
+    //! Nodes selected for recording if record_fraction < 1
+    std::set< index > sampled_targets_;
+
+    //! Statistics per recorded quantity, indexed by time step
+    std::map< long, std::vector< Statistics > > statistics_;
   };
 
   // ------------------------------------------------------------
@@ -219,6 +292,13 @@ nest::multimeter::get_status( DictionaryDatum& d ) const
     return; // no data to collect
   }
 
+  if ( P_.record_fraction_ < 1.0 )
+  {
+    initialize_property_intvector( d, names::sampled_targets );
+    const std::vector< long > sampled_targets( B_.sampled_targets_.begin(), B_.sampled_targets_.end() );
+    append_property( d, names::sampled_targets, sampled_targets );
+  }
+
   // if we are the device on thread 0, also get the data from the
   // siblings on other threads
   if ( get_thread() == 0 )
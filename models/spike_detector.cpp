@@ -43,14 +43,27 @@
 
 nest::spike_detector::spike_detector()
   : RecordingDevice()
+  , spikes_()
 {
 }
 
 nest::spike_detector::spike_detector( const spike_detector& n )
   : RecordingDevice( n )
+  , spikes_()
 {
 }
 
+void
+nest::spike_detector::set_initialized_()
+{
+  RecordingDevice::set_initialized_();
+
+  if ( not is_model_prototype() )
+  {
+    kernel().io_manager.register_buffering_recorder( *this );
+  }
+}
+
 void
 nest::spike_detector::calibrate()
 {
@@ -60,7 +73,7 @@ nest::spike_detector::calibrate()
 void
 nest::spike_detector::update( Time const&, const long, const long )
 {
-  // Nothing to do. Writing to the backend happens in handle().
+  // Nothing to do. Writing to the backend happens in write_buffered_records().
 }
 
 nest::RecordingDevice::Type
@@ -105,9 +118,17 @@ nest::spike_detector::handle( SpikeEvent& e )
   {
     assert( e.get_multiplicity() > 0 );
 
-    for ( int i = 0; i < e.get_multiplicity(); ++i )
-    {
-      write( e, RecordingBackend::NO_DOUBLE_VALUES, RecordingBackend::NO_LONG_VALUES );
-    }
+    const RecordedSpike spike = { e.get_sender_node_id(), e.get_stamp().get_steps(), e.get_offset() };
+    spikes_.insert( spikes_.end(), e.get_multiplicity(), spike );
+  }
+}
+
+void
+nest::spike_detector::write_buffered_records()
+{
+  if ( not spikes_.empty() )
+  {
+    write_spikes( spikes_ );
+    spikes_.clear(); // keeps the capacity for the next time slice
   }
 }
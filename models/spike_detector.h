@@ -45,8 +45,9 @@ Description
 
 The most universal collector device is the ``spike_detector``, which
 collects and records all *spikes* it receives from neurons that are
-connected to it. Each spike received by the spike detector is
-immediately handed over to the selected recording backend for further
+connected to it. The spikes received by the spike detector during a
+time slice of the simulation are collected and handed over to the
+selected recording backend at the end of the time slice for further
 processing.
 
 Any node from which spikes are to be recorded, must be connected to
@@ -117,9 +118,17 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void write_buffered_records() override;
+
+protected:
+  void set_initialized_() override;
+
 private:
   void calibrate();
   void update( Time const&, const long, const long );
+
+  //! Spikes received during the current time slice, one entry per spike
+  std::vector< RecordedSpike > spikes_;
 };
 
 inline port
@@ -0,0 +1,367 @@
+/*
+ *  spike_file_generator.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_file_generator.h"
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <cstring>
+#include <exception>
+#include <map>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "dict_util.h"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "exceptions.h"
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "dict.h"
+#include "dictutils.h"
+#include "integerdatum.h"
+#include "stringdatum.h"
+
+namespace
+{
+const char spike_file_magic[] = "NESTSPK1";
+const size_t spike_file_magic_length = 8;
+}
+
+/* ----------------------------------------------------------------
+ * Spike files
+ * ---------------------------------------------------------------- */
+
+std::shared_ptr< const nest::SpikeFile >
+nest::SpikeFile::get( const std::string& filename )
+{
+  // Generators on all threads look up files in the same registry. The
+  // registry does not keep files alive, so a file is unmapped as soon as
+  // no generator uses it.
+  static std::map< std::string, std::weak_ptr< const SpikeFile > > files;
+
+  std::shared_ptr< const SpikeFile > file;
+  std::exception_ptr error; // exceptions must not leave the critical section
+#pragma omp critical( spike_file_registry )
+  {
+    file = files[ filename ].lock();
+    if ( not file )
+    {
+      try
+      {
+        file = std::shared_ptr< const SpikeFile >( new SpikeFile( filename ) );
+        files[ filename ] = file;
+      }
+      catch ( ... )
+      {
+        files.erase( filename );
+        error = std::current_exception();
+      }
+    }
+  }
+
+  if ( error )
+  {
+    std::rethrow_exception( error );
+  }
+  return file;
+}
+
+nest::SpikeFile::SpikeFile( const std::string& filename )
+  : data_( nullptr )
+  , size_( 0 )
+  , num_channels_( 0 )
+  , offsets_( nullptr )
+  , times_( nullptr )
+{
+  const int fd = ::open( filename.c_str(), O_RDONLY );
+  if ( fd < 0 )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+    LOG( M_ERROR, "spike_file_generator::set_status()", msg );
+    throw IOError();
+  }
+
+  struct stat file_status;
+  if ( fstat( fd, &file_status ) < 0 )
+  {
+    ::close( fd );
+    throw IOError();
+  }
+  size_ = file_status.st_size;
+
+  const size_t header_size = spike_file_magic_length + sizeof( uint64_t );
+  if ( size_ < header_size )
+  {
+    ::close( fd );
+    throw BadProperty( String::compose( "The file '%1' is not a spike file.", filename ) );
+  }
+
+  data_ = mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+  ::close( fd ); // the mapping remains valid
+  if ( data_ == MAP_FAILED )
+  {
+    data_ = nullptr;
+    std::string msg = String::compose( "I/O error while mapping file '%1'.", filename );
+    LOG( M_ERROR, "spike_file_generator::set_status()", msg );
+    throw IOError();
+  }
+
+  const char* bytes = static_cast< const char* >( data_ );
+  uint64_t num_channels;
+  std::memcpy( &num_channels, bytes + spike_file_magic_length, sizeof( uint64_t ) );
+
+  const size_t index_size = ( num_channels + 1 ) * sizeof( uint64_t );
+  bool valid = std::memcmp( bytes, spike_file_magic, spike_file_magic_length ) == 0
+    and num_channels < size_ / sizeof( uint64_t ) and header_size + index_size <= size_;
+  if ( valid )
+  {
+    num_channels_ = num_channels;
+    offsets_ = reinterpret_cast< const uint64_t* >( bytes + header_size );
+    times_ = reinterpret_cast< const double* >( bytes + header_size + index_size );
+    valid = offsets_[ 0 ] == 0
+      and offsets_[ num_channels_ ] * sizeof( double ) == size_ - header_size - index_size;
+    for ( size_t channel = 0; valid and channel < num_channels_; ++channel )
+    {
+      valid = offsets_[ channel ] <= offsets_[ channel + 1 ];
+    }
+  }
+
+  if ( not valid )
+  {
+    munmap( data_, size_ );
+    data_ = nullptr;
+    throw BadProperty( String::compose( "The file '%1' is not a spike file.", filename ) );
+  }
+}
+
+nest::SpikeFile::~SpikeFile()
+{
+  if ( data_ )
+  {
+    munmap( data_, size_ );
+  }
+}
+
+/* ----------------------------------------------------------------
+ * Default constructors defining default parameters and state
+ * ---------------------------------------------------------------- */
+
+nest::spike_file_generator::Parameters_::Parameters_()
+  : filename_()
+  , channel_( -1 )
+  , file_()
+{
+}
+
+nest::spike_file_generator::State_::State_()
+  : position_( 0 )
+  , end_( 0 )
+  , positioned_( false )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Parameter extraction and manipulation functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_file_generator::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::filename ] = filename_;
+  ( *d )[ names::channel ] = channel_;
+}
+
+void
+nest::spike_file_generator::Parameters_::set( const DictionaryDatum& d, State_& s, Node* node )
+{
+  const bool filename_changed = updateValue< std::string >( d, names::filename, filename_ );
+  const bool channel_changed = updateValueParam< long >( d, names::channel, channel_, node );
+  if ( not( filename_changed or channel_changed ) )
+  {
+    return;
+  }
+
+  if ( filename_changed )
+  {
+    file_ = filename_.empty() ? std::shared_ptr< const SpikeFile >() : SpikeFile::get( filename_ );
+  }
+
+  if ( channel_ < -1 or ( file_ and channel_ >= static_cast< long >( file_->get_num_channels() ) ) )
+  {
+    throw BadProperty( "The channel must be an index of a channel in the spike file, or -1." );
+  }
+
+  s.positioned_ = false;
+}
+
+/* ----------------------------------------------------------------
+ * Default and copy constructor for device
+ * ---------------------------------------------------------------- */
+
+nest::spike_file_generator::spike_file_generator()
+  : DeviceNode()
+  , device_()
+  , P_()
+  , S_()
+{
+}
+
+nest::spike_file_generator::spike_file_generator( const spike_file_generator& n )
+  : DeviceNode( n )
+  , device_( n.device_ )
+  , P_( n.P_ )
+  , S_( n.S_ )
+{
+}
+
+
+/* ----------------------------------------------------------------
+ * Node initialization functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_file_generator::init_state_( const Node& proto )
+{
+  const spike_file_generator& pr = downcast< spike_file_generator >( proto );
+
+  device_.init_state( pr.device_ );
+  S_ = pr.S_;
+}
+
+void
+nest::spike_file_generator::init_buffers_()
+{
+  device_.init_buffers();
+}
+
+void
+nest::spike_file_generator::calibrate()
+{
+  device_.calibrate();
+
+  if ( S_.positioned_ or not P_.file_ or P_.channel_ < 0 )
+  {
+    return;
+  }
+
+  // Find the first spike after the current time by bisection, so that only
+  // the pages holding the upcoming spikes of the channel are read.
+  const Time now = kernel().simulation_manager.get_time();
+  const Time& origin = device_.get_origin();
+  size_t first = P_.file_->get_begin( P_.channel_ );
+  size_t last = P_.file_->get_end( P_.channel_ );
+  while ( first < last )
+  {
+    const size_t middle = first + ( last - first ) / 2;
+    if ( origin + Time( Time::ms_stamp( P_.file_->get_time( middle ) ) ) <= now )
+    {
+      first = middle + 1;
+    }
+    else
+    {
+      last = middle;
+    }
+  }
+
+  S_.position_ = first;
+  S_.end_ = P_.file_->get_end( P_.channel_ );
+  S_.positioned_ = true;
+}
+
+
+/* ----------------------------------------------------------------
+ * Other functions
+ * ---------------------------------------------------------------- */
+
+void
+nest::spike_file_generator::update( Time const& sliceT0, const long from, const long to )
+{
+  if ( not S_.positioned_ )
+  {
+    return;
+  }
+
+  const Time tstart = sliceT0 + Time::step( from );
+  const Time tstop = sliceT0 + Time::step( to );
+  const Time& origin = device_.get_origin();
+
+  // We fire all spikes with time stamps up to including sliceT0 + to
+  while ( S_.position_ < S_.end_ )
+  {
+    const Time tnext_stamp = origin + Time( Time::ms_stamp( P_.file_->get_time( S_.position_ ) ) );
+
+    // spikes in the past are skipped
+    if ( tnext_stamp <= tstart )
+    {
+      ++S_.position_;
+      continue;
+    }
+    if ( tnext_stamp > tstop )
+    {
+      break;
+    }
+
+    if ( device_.is_active( tnext_stamp ) )
+    {
+      SpikeEvent se;
+
+      // we need to subtract one from stamp which is added again in send()
+      long lag = Time( tnext_stamp - sliceT0 ).get_steps() - 1;
+      kernel().event_delivery_manager.send( *this, se, lag );
+    }
+
+    ++S_.position_;
+  }
+}
+
+void
+nest::spike_file_generator::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  State_ stmp = S_;
+
+  // throws if BadProperty
+  ptmp.set( d, stmp, this );
+  if ( d->known( names::origin ) )
+  {
+    stmp.positioned_ = false;
+  }
+
+  // We now know that ptmp is consistent. We do not write it back
+  // to P_ before we are also sure that the properties to be set
+  // in the parent class are internally consistent.
+  device_.set_status( d );
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+  S_ = stmp;
+}
@@ -0,0 +1,275 @@
+/*
+ *  spike_file_generator.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SPIKE_FILE_GENERATOR_H
+#define SPIKE_FILE_GENERATOR_H
+
+// C++ includes:
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Includes from nestkernel:
+#include "connection.h"
+#include "device_node.h"
+#include "event.h"
+#include "nest_time.h"
+#include "nest_types.h"
+#include "stimulating_device.h"
+
+namespace nest
+{
+
+/* BeginUserDocs: device, generator
+
+Short description
++++++++++++++++++
+
+A device which generates spikes from times stored in a binary file
+
+Description
++++++++++++
+
+A spike file generator emits spikes at the times given for one channel
+of a binary spike file. In contrast to the :doc:`spike_generator
+<spike_generator>`, the spike times are not passed to the generator as
+an array, but read from the file during the simulation. All generators
+reading from the same file on an MPI process share a single read-only
+memory mapping of the file. Only the pages holding the spikes of the
+upcoming time slice are read into memory, so the activity of millions
+of input channels can be replayed without loading it in advance.
+
+The file consists of a header, an index and the spike times, all in
+the byte order of the machine:
+
+* 8 bytes holding the characters ``NESTSPK1``
+* the number of channels N as unsigned 64 bit integer
+* N+1 offsets as unsigned 64 bit integers, where the spikes of
+  channel i are stored at positions offset[i] up to but not including
+  offset[i+1] of the spike times
+* the spike times in ms as 64 bit floats, sorted in ascending order
+  within each channel
+
+Spike times are relative to the `origin` of the generator and are
+rounded up to the next multiple of the simulation resolution. Spikes
+at or before the current time are skipped.
+
+Parameters
+++++++++++
+
+The following parameters can be set in the status dictionary. Setting
+either of them restarts the replay with the first spike after the
+current time.
+
+.. glossary::
+
+ filename
+   The name of the spike file.
+
+ channel
+   The index of the channel within the file from which the generator
+   takes its spike times. Channels are usually assigned to generators
+   in order of their node IDs, e.g. ``nest.Create("spike_file_generator",
+   N, {"filename": "input.spk", "channel": list(range(N))})``.
+
+Sends
++++++
+
+SpikeEvent
+
+See also
+++++++++
+
+spike_generator
+
+EndUserDocs */
+
+class SpikeFile;
+
+class spike_file_generator : public DeviceNode
+{
+
+public:
+  spike_file_generator();
+  spike_file_generator( const spike_file_generator& );
+
+  bool
+  has_proxies() const
+  {
+    return false;
+  }
+
+  Name
+  get_element_type() const
+  {
+    return names::stimulator;
+  }
+
+  port send_test_event( Node&, rport, synindex, bool );
+  void get_status( DictionaryDatum& ) const;
+  void set_status( const DictionaryDatum& );
+
+  using Node::sends_signal;
+
+  SignalType
+  sends_signal() const
+  {
+    return ALL;
+  }
+
+private:
+  void init_state_( const Node& );
+  void init_buffers_();
+  void calibrate();
+
+  void update( Time const&, const long, const long );
+
+  // ------------------------------------------------------------
+
+  struct State_
+  {
+    size_t position_; //!< index of next spike to deliver
+    size_t end_;      //!< index behind the last spike of the channel
+    bool positioned_; //!< whether position_ points to the first spike after the current time
+
+    State_(); //!< Sets default state value
+  };
+
+  // ------------------------------------------------------------
+
+  struct Parameters_
+  {
+    std::string filename_; //!< name of the spike file
+    long channel_;         //!< channel of the file to replay, -1 if unset
+
+    //! shared mapping of the spike file, null if no file is set
+    std::shared_ptr< const SpikeFile > file_;
+
+    Parameters_(); //!< Sets default parameter values
+
+    void get( DictionaryDatum& ) const; //!< Store current values in dictionary
+
+    /**
+     * Set values from dictionary.
+     * @note State is passed so that the position can be reset if the file
+     *       or the channel change.
+     */
+    void set( const DictionaryDatum&, State_&, Node* node );
+  };
+
+  // ------------------------------------------------------------
+
+  StimulatingDevice< SpikeEvent > device_;
+
+  Parameters_ P_;
+  State_ S_;
+};
+
+/**
+ * A spike file mapped into memory.
+ *
+ * Instances are shared by all spike_file_generators reading from the same
+ * file on an MPI process. The file is unmapped once the last generator
+ * using it is destroyed or switches to another file.
+ */
+class SpikeFile
+{
+public:
+  /**
+   * Return the mapping of the given file, mapping the file if no
+   * generator uses it yet.
+   * @throws IOError if the file cannot be mapped
+   * @throws BadProperty if the file is not a valid spike file
+   */
+  static std::shared_ptr< const SpikeFile > get( const std::string& filename );
+
+  ~SpikeFile();
+
+  SpikeFile( const SpikeFile& ) = delete;
+  SpikeFile& operator=( const SpikeFile& ) = delete;
+
+  size_t
+  get_num_channels() const
+  {
+    return num_channels_;
+  }
+
+  //! Index of the first spike of a channel
+  size_t
+  get_begin( size_t channel ) const
+  {
+    return offsets_[ channel ];
+  }
+
+  //! Index behind the last spike of a channel
+  size_t
+  get_end( size_t channel ) const
+  {
+    return offsets_[ channel + 1 ];
+  }
+
+  //! Spike time with the given index, in ms
+  double
+  get_time( size_t index ) const
+  {
+    return times_[ index ];
+  }
+
+private:
+  explicit SpikeFile( const std::string& filename );
+
+  void* data_;              //!< mapping of the whole file
+  size_t size_;             //!< size of the file in bytes
+  size_t num_channels_;     //!< number of channels in the file
+  const uint64_t* offsets_; //!< index of the file, num_channels_ + 1 entries
+  const double* times_;     //!< spike times of all channels
+};
+
+inline port
+spike_file_generator::send_test_event( Node& target, rport receptor_type, synindex syn_id, bool dummy_target )
+{
+  device_.enforce_single_syn_type( syn_id );
+
+  if ( dummy_target )
+  {
+    DSSpikeEvent e;
+    e.set_sender( *this );
+    return target.handles_test_event( e, receptor_type );
+  }
+  else
+  {
+    SpikeEvent e;
+    e.set_sender( *this );
+    return target.handles_test_event( e, receptor_type );
+  }
+}
+
+inline void
+spike_file_generator::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+  device_.get_status( d );
+}
+
+} // namespace
+
+#endif /* #ifndef SPIKE_FILE_GENERATOR_H */
@@ -22,6 +22,9 @@
 
 #include "spike_generator.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "event_delivery_manager_impl.h"
 #include "exceptions.h"
@@ -329,6 +332,12 @@ nest::spike_generator::calibrate()
   device_.calibrate();
 }
 
+void
+nest::spike_generator::set_initialized_()
+{
+  device_.enroll_stimulus_source( *this );
+}
+
 
 /* ----------------------------------------------------------------
  * Other functions
@@ -404,6 +413,30 @@ nest::spike_generator::update( Time const& sliceT0, const long from, const long
   }
 }
 
+void
+nest::spike_generator::set_data_from_stimulation_backend( const std::vector< double >& data )
+{
+  P_.spike_stamps_.clear();
+  P_.spike_offsets_.clear();
+  P_.spike_weights_.clear();
+  P_.spike_multiplicities_.clear();
+
+  // The rows are validated by the backend, so spike times are only
+  // rounded to the end of the step they fall into.
+  for ( size_t i = 0; i < data.size(); i += 2 )
+  {
+    const Time t_spike = Time( Time::ms_stamp( data[ i ] ) );
+    P_.spike_stamps_.push_back( t_spike );
+    if ( P_.precise_times_ )
+    {
+      P_.spike_offsets_.push_back( std::max( 0.0, t_spike.get_ms() - data[ i ] ) );
+    }
+    P_.spike_weights_.push_back( data[ i + 1 ] );
+  }
+
+  S_.position_ = 0;
+}
+
 void
 nest::spike_generator::event_hook( DSSpikeEvent& e )
 {
@@ -437,6 +470,7 @@ nest::spike_generator::set_status( const DictionaryDatum& d )
   // to P_ before we are also sure that the properties to be set
   // in the parent class are internally consistent.
   device_.set_status( d );
+  device_.set_stimulus_source( d, *this );
 
   // if we get here, temporary contains consistent set of properties
   P_ = ptmp;
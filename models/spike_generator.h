@@ -165,8 +165,15 @@ The following properties can be set in the status dictionary.
  precise_times        boolean       see above
  allow_offgrid_times  boolean       see above
  shift_now_spikes     boolean       see above
+ stimulus_source      string        Name of the stimulation backend
+                                    supplying the spikes, e.g. *"file"*;
+                                    empty to use spike_times
 ===================== ============= ==========================================
 
+If stimulus_source is set, the spike times and weights are replaced by
+those supplied by the stimulation backend during the simulation, see
+:ref:`file_stimulation_backend`.
+
 Sends
 +++++
 
@@ -207,6 +214,8 @@ public:
 
   void event_hook( DSSpikeEvent& );
 
+  void set_data_from_stimulation_backend( const std::vector< double >& ) override;
+
   SignalType
   sends_signal() const
   {
@@ -217,6 +226,7 @@ private:
   void init_state_( const Node& );
   void init_buffers_();
   void calibrate();
+  void set_initialized_();
 
   void update( Time const&, const long, const long );
 
@@ -307,6 +317,7 @@ spike_generator::get_status( DictionaryDatum& d ) const
 {
   P_.get( d );
   device_.get_status( d );
+  device_.get_stimulus_source( d, *this );
 }
 
 } // namespace
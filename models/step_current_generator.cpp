@@ -273,6 +273,12 @@ nest::step_current_generator::calibrate()
   device_.calibrate();
 }
 
+void
+nest::step_current_generator::set_initialized_()
+{
+  device_.enroll_stimulus_source( *this );
+}
+
 
 /* ----------------------------------------------------------------
  * Update function and event hook
@@ -323,6 +329,32 @@ nest::step_current_generator::update( Time const& origin, const long from, const
   }
 }
 
+void
+nest::step_current_generator::set_data_from_stimulation_backend( const std::vector< double >& data )
+{
+  P_.amp_time_stamps_.clear();
+  P_.amp_values_.clear();
+
+  // The rows are validated by the backend, so times are only rounded to
+  // the end of the step they fall into. The last change within a step wins.
+  for ( size_t i = 0; i < data.size(); i += 2 )
+  {
+    const Time t_amp = Time( Time::ms_stamp( data[ i ] ) );
+    if ( not P_.amp_time_stamps_.empty() and P_.amp_time_stamps_.back() == t_amp )
+    {
+      P_.amp_values_.back() = data[ i + 1 ];
+    }
+    else
+    {
+      P_.amp_time_stamps_.push_back( t_amp );
+      P_.amp_values_.push_back( data[ i + 1 ] );
+    }
+  }
+
+  // The current amplitude B_.amp_ is kept until the next change.
+  B_.idx_ = 0;
+}
+
 void
 nest::step_current_generator::handle( DataLoggingRequest& e )
 {
@@ -73,8 +73,16 @@ The following parameters can be set in the status dictionary:
  amplitude_times     list of ms       Times at which current changes
  amplitude_values    list of pA       Amplitudes of step current current
  allow_offgrid_times boolean          Default false
+ stimulus_source     string           Name of the stimulation backend
+                                      supplying the amplitude changes, e.g.
+                                      *"file"*; empty to use amplitude_times
+                                      and amplitude_values
 ==================== ===============  ======================================
 
+If stimulus_source is set, the amplitude times and values are replaced by
+those supplied by the stimulation backend during the simulation, see
+:ref:`file_stimulation_backend`.
+
 Sends
 +++++
 
@@ -125,10 +133,13 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void set_data_from_stimulation_backend( const std::vector< double >& ) override;
+
 private:
   void init_state_( const Node& );
   void init_buffers_();
   void calibrate();
+  void set_initialized_();
 
   void update( Time const&, const long, const long );
 
@@ -238,6 +249,7 @@ step_current_generator::get_status( DictionaryDatum& d ) const
 {
   P_.get( d );
   device_.get_status( d );
+  device_.get_stimulus_source( d, *this );
 
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
 }
@@ -252,6 +264,7 @@ step_current_generator::set_status( const DictionaryDatum& d )
   // to P_ before we are also sure that the properties to be set
   // in the parent class are internally consistent.
   device_.set_status( d );
+  device_.set_stimulus_source( d, *this );
 
   // if we get here, temporaries contain consistent set of properties
   P_ = ptmp;
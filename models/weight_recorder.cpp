@@ -23,6 +23,7 @@
 #include "weight_recorder.h"
 
 // C++ includes:
+#include <algorithm>
 #include <numeric>
 
 // Includes from libnestutil:
@@ -47,24 +48,30 @@
 nest::weight_recorder::weight_recorder()
   : RecordingDevice()
   , P_()
+  , records_()
+  , snapshot_steps_( 0 )
 {
 }
 
 nest::weight_recorder::weight_recorder( const weight_recorder& n )
   : RecordingDevice( n )
   , P_( n.P_ )
+  , records_()
+  , snapshot_steps_( 0 )
 {
 }
 
 nest::weight_recorder::Parameters_::Parameters_()
   : senders_()
   , targets_()
+  , snapshot_interval_( 0.0 )
 {
 }
 
 nest::weight_recorder::Parameters_::Parameters_( const Parameters_& p )
   : senders_( p.senders_ )
   , targets_( p.targets_ )
+  , snapshot_interval_( p.snapshot_interval_ )
 {
 }
 
@@ -89,6 +96,7 @@ nest::weight_recorder::Parameters_::get( DictionaryDatum& d ) const
     ArrayDatum ad;
     ( *d )[ names::targets ] = ad;
   }
+  ( *d )[ names::snapshot_interval ] = snapshot_interval_;
 }
 
 void
@@ -137,6 +145,27 @@ nest::weight_recorder::Parameters_::set( const DictionaryDatum& d )
       }
     }
   }
+
+  double snapshot_interval = snapshot_interval_;
+  if ( updateValue< double >( d, names::snapshot_interval, snapshot_interval ) )
+  {
+    if ( snapshot_interval < 0 or not Time( Time::ms( snapshot_interval ) ).is_step() )
+    {
+      throw BadProperty( "snapshot_interval must be zero or a positive multiple of the resolution." );
+    }
+    snapshot_interval_ = snapshot_interval;
+  }
+}
+
+void
+nest::weight_recorder::set_initialized_()
+{
+  RecordingDevice::set_initialized_();
+
+  if ( not is_model_prototype() )
+  {
+    kernel().io_manager.register_buffering_recorder( *this );
+  }
 }
 
 void
@@ -144,11 +173,104 @@ nest::weight_recorder::calibrate()
 {
   RecordingDevice::calibrate(
     { nest::names::weights }, { nest::names::targets, nest::names::receptors, nest::names::ports } );
+
+  snapshot_steps_ = Time( Time::ms( P_.snapshot_interval_ ) ).get_steps();
+
+  // the connections are selected by binary search in sorted node IDs
+  snapshot_senders_.clear();
+  snapshot_targets_.clear();
+  if ( snapshot_steps_ > 0 )
+  {
+    if ( P_.senders_.get() )
+    {
+      for ( NodeCollection::const_iterator it = P_.senders_->begin(); it < P_.senders_->end(); ++it )
+      {
+        snapshot_senders_.push_back( ( *it ).node_id );
+      }
+      std::sort( snapshot_senders_.begin(), snapshot_senders_.end() );
+    }
+    if ( P_.targets_.get() )
+    {
+      for ( NodeCollection::const_iterator it = P_.targets_->begin(); it < P_.targets_->end(); ++it )
+      {
+        snapshot_targets_.push_back( ( *it ).node_id );
+      }
+      std::sort( snapshot_targets_.begin(), snapshot_targets_.end() );
+    }
+  }
 }
 
 void
-nest::weight_recorder::update( Time const&, const long from, const long to )
+nest::weight_recorder::update( Time const& origin, const long from, const long to )
 {
+  if ( snapshot_steps_ == 0 )
+  {
+    return;
+  }
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // a snapshot at time t is stamped like a spike emitted in the step
+    // ending at t
+    const long step = origin.get_steps() + lag + 1;
+    const Time stamp = Time::step( step );
+    if ( step % snapshot_steps_ == 0 and is_active( stamp ) )
+    {
+      take_snapshot_( stamp );
+    }
+  }
+}
+
+void
+nest::weight_recorder::take_snapshot_( const Time& stamp )
+{
+  // empty collections of senders or targets select no synapses, while
+  // empty vectors of node IDs select all
+  if ( ( P_.senders_.get() and snapshot_senders_.empty() ) or ( P_.targets_.get() and snapshot_targets_.empty() ) )
+  {
+    return;
+  }
+
+  kernel().connection_manager.get_recorded_connections(
+    get_thread(), get_node_id(), snapshot_senders_, snapshot_targets_, snapshot_connections_ );
+
+  const ConnectionColumns& conns = snapshot_connections_;
+  records_.reserve( records_.size() + conns.size() );
+  for ( size_t i = 0; i < conns.size(); ++i )
+  {
+    records_.push_back( { static_cast< index >( conns.sources[ i ] ),
+      static_cast< index >( conns.targets[ i ] ),
+      stamp,
+      0.0,
+      conns.weights[ i ],
+      conns.receptors[ i ],
+      conns.ports[ i ] } );
+  }
+}
+
+void
+nest::weight_recorder::write_buffered_records()
+{
+  if ( records_.empty() )
+  {
+    return;
+  }
+
+  WeightRecorderEvent e;
+  std::vector< double > double_values( 1 );
+  std::vector< long > long_values( 3 );
+  for ( const auto& record : records_ )
+  {
+    e.set_sender_node_id( record.sender );
+    e.set_stamp( record.stamp );
+    e.set_offset( record.offset );
+    double_values[ 0 ] = record.weight;
+    long_values[ 0 ] = record.target;
+    long_values[ 1 ] = record.rport;
+    long_values[ 2 ] = record.port;
+    write( e, double_values, long_values );
+  }
+  records_.clear(); // keeps the capacity for the next time slice
 }
 
 nest::RecordingDevice::Type
@@ -197,6 +319,12 @@ nest::weight_recorder::set_status( const DictionaryDatum& d )
 void
 nest::weight_recorder::handle( WeightRecorderEvent& e )
 {
+  // in snapshot mode, weights are only recorded in update()
+  if ( P_.snapshot_interval_ > 0 )
+  {
+    return;
+  }
+
   // accept spikes only if detector was active when spike was
   // emitted
   if ( is_active( e.get_stamp() ) )
@@ -209,10 +337,12 @@ nest::weight_recorder::handle( WeightRecorderEvent& e )
       return;
     }
 
-    write( e,
-      { e.get_weight() },
-      { static_cast< long >( e.get_receiver_node_id() ),
-       static_cast< long >( e.get_rport() ),
-       static_cast< long >( e.get_port() ) } );
+    records_.push_back( { e.get_sender_node_id(),
+      e.get_receiver_node_id(),
+      e.get_stamp(),
+      e.get_offset(),
+      e.get_weight(),
+      static_cast< long >( e.get_rport() ),
+      static_cast< long >( e.get_port() ) } );
   }
 }
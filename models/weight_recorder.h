@@ -27,6 +27,7 @@
 #include <vector>
 
 // Includes from nestkernel:
+#include "connection_columns.h"
 #include "device_node.h"
 #include "event.h"
 #include "exceptions.h"
@@ -71,6 +72,40 @@ synapses that fulfill the given criteria.
 
    >>> nest.Connect(pre, post, syn_spec="stdp_synapse_rec")
 
+The weight recorder collects the records of each thread during a time
+slice and passes them to the recording backend at the end of the slice.
+
+Snapshot mode
++++++++++++++
+
+Recording every transmitted spike of a large number of plastic synapses
+produces a large amount of data. If ``snapshot_interval`` is set to a
+positive value, the weight recorder ignores the transmitted spikes and
+instead records the current weights of all observed synapses at every
+multiple of ``snapshot_interval``, so that the amount of data only
+depends on the number of observed synapses. The weights are read directly
+from the connections in the update of the time slice containing the
+snapshot time. They include all changes caused by spikes delivered before
+that time slice. As in the spike-driven mode, ``senders`` and ``targets``
+restrict the recording to a subset of the synapses. Connections from or
+to devices are not included.
+
+::
+
+   >>> wr = nest.Create('weight_recorder', params={'snapshot_interval': 100.})
+
+Parameters
+++++++++++
+
+================= ====== ======================================================
+senders           list   If set, only record synapses from these nodes
+targets           list   If set, only record synapses to these nodes
+snapshot_interval ms     If positive, record the weights of all observed
+                         synapses at multiples of this interval instead of
+                         on each spike. Must be a multiple of the
+                         resolution. Default is 0.
+================= ====== ======================================================
+
 EndUserDocs */
 
 namespace nest
@@ -120,14 +155,38 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void write_buffered_records() override;
+
+protected:
+  void set_initialized_() override;
+
 private:
   void calibrate();
   void update( Time const&, const long, const long );
 
+  //! Record the weights of all observed synapses of this thread
+  void take_snapshot_( const Time& stamp );
+
+  /**
+   * Weight of a synapse at a given time, buffered until the end of the
+   * time slice.
+   */
+  struct WeightRecord_
+  {
+    index sender;
+    index target;
+    Time stamp;
+    double offset;
+    double weight;
+    long rport;
+    long port;
+  };
+
   struct Parameters_
   {
     NodeCollectionDatum senders_;
     NodeCollectionDatum targets_;
+    double snapshot_interval_; //!< interval of snapshots in ms, 0 for recording on each spike
 
     Parameters_();
     Parameters_( const Parameters_& );
@@ -136,6 +195,14 @@ private:
   };
 
   Parameters_ P_;
+
+  //! Records of the current time slice
+  std::vector< WeightRecord_ > records_;
+
+  long snapshot_steps_;                    //!< snapshot_interval in steps, 0 if not in snapshot mode
+  std::vector< index > snapshot_senders_;  //!< sorted node IDs of senders_
+  std::vector< index > snapshot_targets_;  //!< sorted node IDs of targets_
+  ConnectionColumns snapshot_connections_; //!< reused for each snapshot
 };
 
 inline port
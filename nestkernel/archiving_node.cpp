@@ -30,6 +30,7 @@
 #include "archiving_node.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "kernel_manager.h"
 
 // Includes from sli:
@@ -465,4 +466,52 @@ nest::Archiving_Node::connect_synaptic_element( Name name, int n )
   }
 }
 
+void
+nest::Archiving_Node::write_checkpoint( std::ostream& os ) const
+{
+  write_checkpoint_value( os, n_incoming_ );
+  write_checkpoint_value( os, Kminus_ );
+  write_checkpoint_value( os, Kminus_triplet_ );
+  write_checkpoint_value( os, max_delay_ );
+  write_checkpoint_value( os, trace_ );
+  write_checkpoint_value( os, last_spike_ );
+  write_checkpoint_value( os, Ca_t_ );
+  write_checkpoint_value( os, Ca_minus_ );
+
+  write_checkpoint_value( os, history_.size() );
+  for ( std::deque< histentry >::const_iterator it = history_.begin(); it != history_.end(); ++it )
+  {
+    write_checkpoint_value( os, *it );
+  }
+}
+
+void
+nest::Archiving_Node::read_checkpoint( std::istream& is )
+{
+  read_checkpoint_value( is, n_incoming_ );
+  read_checkpoint_value( is, Kminus_ );
+  read_checkpoint_value( is, Kminus_triplet_ );
+  read_checkpoint_value( is, max_delay_ );
+  read_checkpoint_value( is, trace_ );
+  read_checkpoint_value( is, last_spike_ );
+  read_checkpoint_value( is, Ca_t_ );
+  read_checkpoint_value( is, Ca_minus_ );
+
+  size_t history_size;
+  read_checkpoint_value( is, history_size );
+  history_.clear();
+  for ( size_t i = 0; i < history_size; ++i )
+  {
+    histentry entry( 0.0, 0.0, 0.0, 0 );
+    read_checkpoint_value( is, entry );
+    history_.push_back( entry );
+  }
+}
+
+size_t
+Archiving_Node::get_buffer_memory() const
+{
+  return history_.size() * sizeof( histentry );
+}
+
 } // of namespace nest
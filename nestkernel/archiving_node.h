@@ -194,6 +194,19 @@ public:
   void get_status( DictionaryDatum& d ) const;
   void set_status( const DictionaryDatum& d );
 
+  /**
+   * Write the spike history and the state of the traces to a checkpoint.
+   * Derived classes that override this function must call it.
+   */
+  void write_checkpoint( std::ostream& ) const;
+  void read_checkpoint( std::istream& );
+
+  /**
+   * Return the bytes used by the spike history. Derived classes that
+   * override this function must add its result.
+   */
+  size_t get_buffer_memory() const;
+
   /**
    * retrieve the current value of tau_Ca which defines the exponential decay
    * constant of the intracellular calcium concentration
@@ -0,0 +1,421 @@
+/*
+ *  checkpoint.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "checkpoint.h"
+
+// C++ includes:
+#include <cstring>
+#include <fstream>
+
+// Generated includes:
+#include "config.h"
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "booldatum.h"
+#include "dictutils.h"
+#include "doubledatum.h"
+#include "integerdatum.h"
+#include "namedatum.h"
+#include "stringdatum.h"
+
+namespace nest
+{
+
+namespace
+{
+//! Identifies checkpoint files, written at the beginning of each file
+const char checkpoint_magic[] = "NESTCKPT";
+
+//! Type tags of dictionary entries in checkpoints
+enum CheckpointDatumType
+{
+  CHECKPOINT_DOUBLE = 0,
+  CHECKPOINT_INTEGER,
+  CHECKPOINT_BOOL,
+  CHECKPOINT_LITERAL,
+  CHECKPOINT_STRING,
+  CHECKPOINT_ARRAY,
+  CHECKPOINT_DOUBLE_VECTOR,
+  CHECKPOINT_INTEGER_VECTOR,
+  CHECKPOINT_DICTIONARY,
+  CHECKPOINT_UNSUPPORTED
+};
+
+CheckpointDatumType
+get_checkpoint_type_( const Token& t )
+{
+  Datum* d = t.datum();
+  if ( dynamic_cast< DoubleDatum* >( d ) )
+  {
+    return CHECKPOINT_DOUBLE;
+  }
+  if ( dynamic_cast< IntegerDatum* >( d ) )
+  {
+    return CHECKPOINT_INTEGER;
+  }
+  if ( dynamic_cast< BoolDatum* >( d ) )
+  {
+    return CHECKPOINT_BOOL;
+  }
+  if ( dynamic_cast< LiteralDatum* >( d ) )
+  {
+    return CHECKPOINT_LITERAL;
+  }
+  if ( dynamic_cast< StringDatum* >( d ) )
+  {
+    return CHECKPOINT_STRING;
+  }
+  if ( dynamic_cast< ArrayDatum* >( d ) )
+  {
+    // only arrays that consist of supported entries
+    const ArrayDatum& array = *static_cast< ArrayDatum* >( d );
+    for ( Token const* it = array.begin(); it != array.end(); ++it )
+    {
+      if ( get_checkpoint_type_( *it ) == CHECKPOINT_UNSUPPORTED )
+      {
+        return CHECKPOINT_UNSUPPORTED;
+      }
+    }
+    return CHECKPOINT_ARRAY;
+  }
+  if ( dynamic_cast< DoubleVectorDatum* >( d ) )
+  {
+    return CHECKPOINT_DOUBLE_VECTOR;
+  }
+  if ( dynamic_cast< IntVectorDatum* >( d ) )
+  {
+    return CHECKPOINT_INTEGER_VECTOR;
+  }
+  if ( dynamic_cast< DictionaryDatum* >( d ) )
+  {
+    return CHECKPOINT_DICTIONARY;
+  }
+  return CHECKPOINT_UNSUPPORTED;
+}
+
+void
+write_checkpoint_token_( std::ostream& os, const Token& t, const CheckpointDatumType type )
+{
+  write_checkpoint_value( os, static_cast< unsigned char >( type ) );
+
+  switch ( type )
+  {
+  case CHECKPOINT_DOUBLE:
+    write_checkpoint_value( os, static_cast< DoubleDatum* >( t.datum() )->get() );
+    break;
+  case CHECKPOINT_INTEGER:
+    write_checkpoint_value( os, static_cast< IntegerDatum* >( t.datum() )->get() );
+    break;
+  case CHECKPOINT_BOOL:
+    write_checkpoint_value( os, static_cast< bool >( *static_cast< BoolDatum* >( t.datum() ) ) );
+    break;
+  case CHECKPOINT_LITERAL:
+    write_checkpoint_string( os, static_cast< LiteralDatum* >( t.datum() )->toString() );
+    break;
+  case CHECKPOINT_STRING:
+    write_checkpoint_string( os, *static_cast< StringDatum* >( t.datum() ) );
+    break;
+  case CHECKPOINT_ARRAY:
+  {
+    const ArrayDatum& array = *static_cast< ArrayDatum* >( t.datum() );
+    write_checkpoint_value( os, array.size() );
+    for ( Token const* it = array.begin(); it != array.end(); ++it )
+    {
+      write_checkpoint_token_( os, *it, get_checkpoint_type_( *it ) );
+    }
+    break;
+  }
+  case CHECKPOINT_DOUBLE_VECTOR:
+    write_checkpoint_vector( os, **static_cast< DoubleVectorDatum* >( t.datum() ) );
+    break;
+  case CHECKPOINT_INTEGER_VECTOR:
+    write_checkpoint_vector( os, **static_cast< IntVectorDatum* >( t.datum() ) );
+    break;
+  case CHECKPOINT_DICTIONARY:
+    write_checkpoint_dictionary( os, *static_cast< DictionaryDatum* >( t.datum() ) );
+    break;
+  default:
+    assert( false );
+  }
+}
+
+Token
+read_checkpoint_token_( std::istream& is )
+{
+  unsigned char type;
+  read_checkpoint_value( is, type );
+
+  switch ( type )
+  {
+  case CHECKPOINT_DOUBLE:
+  {
+    double value;
+    read_checkpoint_value( is, value );
+    return Token( new DoubleDatum( value ) );
+  }
+  case CHECKPOINT_INTEGER:
+  {
+    long value;
+    read_checkpoint_value( is, value );
+    return Token( new IntegerDatum( value ) );
+  }
+  case CHECKPOINT_BOOL:
+  {
+    bool value;
+    read_checkpoint_value( is, value );
+    return Token( new BoolDatum( value ) );
+  }
+  case CHECKPOINT_LITERAL:
+  {
+    std::string value;
+    read_checkpoint_string( is, value );
+    return Token( new LiteralDatum( value ) );
+  }
+  case CHECKPOINT_STRING:
+  {
+    std::string value;
+    read_checkpoint_string( is, value );
+    return Token( new StringDatum( value ) );
+  }
+  case CHECKPOINT_ARRAY:
+  {
+    size_t size;
+    read_checkpoint_value( is, size );
+    ArrayDatum* array = new ArrayDatum();
+    array->reserve( size );
+    for ( size_t i = 0; i < size; ++i )
+    {
+      array->push_back( read_checkpoint_token_( is ) );
+    }
+    return Token( array );
+  }
+  case CHECKPOINT_DOUBLE_VECTOR:
+  {
+    std::vector< double >* values = new std::vector< double >();
+    read_checkpoint_vector( is, *values );
+    return Token( new DoubleVectorDatum( values ) );
+  }
+  case CHECKPOINT_INTEGER_VECTOR:
+  {
+    std::vector< long >* values = new std::vector< long >();
+    read_checkpoint_vector( is, *values );
+    return Token( new IntVectorDatum( values ) );
+  }
+  case CHECKPOINT_DICTIONARY:
+  {
+    DictionaryDatum dict( new Dictionary );
+    read_checkpoint_dictionary( is, dict );
+    return Token( dict );
+  }
+  default:
+    throw KernelException( "Invalid entry in checkpoint file." );
+  }
+}
+
+std::string
+get_checkpoint_filename_( const std::string& name )
+{
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  return data_path + kernel().io_manager.get_data_prefix() + name + "-"
+    + std::to_string( kernel().mpi_manager.get_rank() ) + ".ckpt";
+}
+
+} // namespace
+
+void
+write_checkpoint_string( std::ostream& os, const std::string& s )
+{
+  write_checkpoint_value( os, s.size() );
+  os.write( s.data(), s.size() );
+}
+
+void
+read_checkpoint_string( std::istream& is, std::string& s )
+{
+  size_t size;
+  read_checkpoint_value( is, size );
+  s.resize( size );
+  if ( size > 0 )
+  {
+    is.read( &s[ 0 ], size );
+    if ( not is )
+    {
+      throw KernelException( "Unexpected end of checkpoint file." );
+    }
+  }
+}
+
+void
+write_checkpoint_dictionary( std::ostream& os, const DictionaryDatum& d, const DictionaryDatum& defaults )
+{
+  std::vector< std::pair< Name, CheckpointDatumType > > entries;
+  for ( Dictionary::const_iterator it = d->begin(); it != d->end(); ++it )
+  {
+    if ( defaults.valid() and defaults->known( it->first ) and defaults->lookup( it->first ) == it->second )
+    {
+      continue;
+    }
+
+    const CheckpointDatumType type = get_checkpoint_type_( it->second );
+    if ( type != CHECKPOINT_UNSUPPORTED )
+    {
+      entries.push_back( std::make_pair( it->first, type ) );
+    }
+  }
+
+  write_checkpoint_value( os, entries.size() );
+  for ( size_t i = 0; i < entries.size(); ++i )
+  {
+    write_checkpoint_string( os, entries[ i ].first.toString() );
+    write_checkpoint_token_( os, d->lookup( entries[ i ].first ), entries[ i ].second );
+  }
+}
+
+void
+read_checkpoint_dictionary( std::istream& is, DictionaryDatum& d )
+{
+  size_t size;
+  read_checkpoint_value( is, size );
+  for ( size_t i = 0; i < size; ++i )
+  {
+    std::string key;
+    read_checkpoint_string( is, key );
+    ( *d )[ Name( key ) ] = read_checkpoint_token_( is );
+  }
+}
+
+void
+write_checkpoint( const std::string& name )
+{
+  if ( kernel().simulation_manager.has_been_prepared() )
+  {
+    throw KernelException( "Checkpoints cannot be written between Prepare and Cleanup." );
+  }
+
+  const std::string filename = get_checkpoint_filename_( name );
+  std::ofstream os( filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc );
+  if ( not os.good() )
+  {
+    LOG( M_ERROR, "write_checkpoint", String::compose( "Could not open checkpoint file '%1'.", filename ) );
+    throw IOError();
+  }
+
+  os.write( checkpoint_magic, sizeof( checkpoint_magic ) );
+  write_checkpoint_value( os, checkpoint_format_version );
+  write_checkpoint_string( os, NEST_VERSION_STRING );
+  write_checkpoint_value( os, kernel().mpi_manager.get_num_processes() );
+  write_checkpoint_value( os, kernel().mpi_manager.get_rank() );
+  write_checkpoint_value( os, kernel().vp_manager.get_num_threads() );
+  write_checkpoint_value( os, Time::get_resolution().get_tics() );
+
+  kernel().simulation_manager.write_checkpoint( os );
+  kernel().rng_manager.write_checkpoint( os );
+  kernel().connection_manager.write_delay_checkpoint( os );
+  kernel().node_manager.write_checkpoint( os );
+  kernel().connection_manager.write_checkpoint( os );
+
+  os.close();
+  if ( os.fail() )
+  {
+    LOG( M_ERROR, "write_checkpoint", String::compose( "Could not write checkpoint file '%1'.", filename ) );
+    throw IOError();
+  }
+}
+
+void
+read_checkpoint( const std::string& name )
+{
+  if ( kernel().node_manager.size() > 0 )
+  {
+    throw KernelException( "Checkpoints can only be restored into an empty network. Please call ResetKernel first." );
+  }
+
+  const std::string filename = get_checkpoint_filename_( name );
+  std::ifstream is( filename.c_str(), std::ios::in | std::ios::binary );
+  if ( not is.good() )
+  {
+    LOG( M_ERROR, "read_checkpoint", String::compose( "Could not open checkpoint file '%1'.", filename ) );
+    throw IOError();
+  }
+
+  char magic[ sizeof( checkpoint_magic ) ];
+  is.read( magic, sizeof( magic ) );
+  unsigned int version = 0;
+  if ( is.good() )
+  {
+    read_checkpoint_value( is, version );
+  }
+  if ( std::strncmp( magic, checkpoint_magic, sizeof( magic ) ) != 0 or version != checkpoint_format_version )
+  {
+    throw KernelException(
+      String::compose( "File '%1' is not a checkpoint of format version %2.", filename, checkpoint_format_version ) );
+  }
+
+  std::string nest_version;
+  read_checkpoint_string( is, nest_version );
+  if ( nest_version != NEST_VERSION_STRING )
+  {
+    throw KernelException( String::compose(
+      "Checkpoint '%1' was written by NEST %2 and cannot be restored by NEST %3.", filename, nest_version, NEST_VERSION_STRING ) );
+  }
+
+  thread num_processes;
+  thread rank;
+  thread num_threads;
+  tic_t resolution;
+  read_checkpoint_value( is, num_processes );
+  read_checkpoint_value( is, rank );
+  read_checkpoint_value( is, num_threads );
+  read_checkpoint_value( is, resolution );
+  if ( num_processes != kernel().mpi_manager.get_num_processes() or rank != kernel().mpi_manager.get_rank()
+    or num_threads != kernel().vp_manager.get_num_threads() or resolution != Time::get_resolution().get_tics() )
+  {
+    throw KernelException( String::compose(
+      "Checkpoint '%1' was written with %2 processes, %3 threads per process and a resolution of %4 ms. "
+      "The kernel must be configured accordingly before restoring it.",
+      filename,
+      num_processes,
+      num_threads,
+      Time( Time::tic( resolution ) ).get_ms() ) );
+  }
+
+  kernel().simulation_manager.read_checkpoint( is );
+  kernel().rng_manager.read_checkpoint( is );
+  kernel().connection_manager.read_delay_checkpoint( is );
+  kernel().node_manager.read_checkpoint( is );
+  kernel().connection_manager.read_checkpoint( is );
+}
+
+} // namespace nest
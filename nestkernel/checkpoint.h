@@ -0,0 +1,156 @@
+/*
+ *  checkpoint.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+// C++ includes:
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Includes from nestkernel:
+#include "exceptions.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+
+/**
+ * Binary serialization of the kernel state to checkpoint files.
+ *
+ * A checkpoint consists of one file per MPI process. Each file starts with
+ * a header that identifies the format version and the layout of the kernel
+ * (number of processes and threads, resolution), followed by the sections
+ * written by the SimulationManager, RNGManager, ConnectionManager (delay
+ * extrema), NodeManager and ConnectionManager (connections), in this order. Values are stored in the native binary
+ * representation, so checkpoints can only be restored by the same build of
+ * NEST on the same platform.
+ *
+ * The functions below are used by the managers, nodes and connectors to
+ * read and write their parts of a checkpoint.
+ */
+
+namespace nest
+{
+
+//! Version of the checkpoint format, increase on incompatible changes
+const unsigned int checkpoint_format_version = 1;
+
+/**
+ * Write a value of trivially copyable type to a checkpoint stream.
+ */
+template < typename T >
+inline void
+write_checkpoint_value( std::ostream& os, const T& value )
+{
+  os.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+/**
+ * Read a value of trivially copyable type from a checkpoint stream.
+ * @throws KernelException if the stream ends prematurely.
+ */
+template < typename T >
+inline void
+read_checkpoint_value( std::istream& is, T& value )
+{
+  is.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+  if ( not is )
+  {
+    throw KernelException( "Unexpected end of checkpoint file." );
+  }
+}
+
+/**
+ * Write a vector of values of trivially copyable type.
+ */
+template < typename T >
+inline void
+write_checkpoint_vector( std::ostream& os, const std::vector< T >& values )
+{
+  write_checkpoint_value( os, values.size() );
+  if ( not values.empty() )
+  {
+    os.write( reinterpret_cast< const char* >( &values[ 0 ] ), values.size() * sizeof( T ) );
+  }
+}
+
+/**
+ * Read a vector of values of trivially copyable type, replacing the
+ * content of values.
+ */
+template < typename T >
+inline void
+read_checkpoint_vector( std::istream& is, std::vector< T >& values )
+{
+  size_t size;
+  read_checkpoint_value( is, size );
+  values.resize( size );
+  if ( size > 0 )
+  {
+    is.read( reinterpret_cast< char* >( &values[ 0 ] ), size * sizeof( T ) );
+    if ( not is )
+    {
+      throw KernelException( "Unexpected end of checkpoint file." );
+    }
+  }
+}
+
+void write_checkpoint_string( std::ostream&, const std::string& );
+void read_checkpoint_string( std::istream&, std::string& );
+
+/**
+ * Write the entries of a status dictionary.
+ *
+ * Entries of type double, integer, bool, literal, string, array, vector and
+ * dictionary are written, all other entries are silently skipped. If
+ * defaults is given, only entries which differ from the entry of the same
+ * name in defaults are written.
+ */
+void write_checkpoint_dictionary( std::ostream&, const DictionaryDatum&, const DictionaryDatum& defaults = DictionaryDatum() );
+
+/**
+ * Read a dictionary written by write_checkpoint_dictionary().
+ */
+void read_checkpoint_dictionary( std::istream&, DictionaryDatum& );
+
+/**
+ * Write the checkpoint of this MPI process.
+ *
+ * The file name is formed from the kernel properties data_path and
+ * data_prefix, the given name and the rank of the process.
+ */
+void write_checkpoint( const std::string& name );
+
+/**
+ * Restore the kernel state from a checkpoint written by write_checkpoint().
+ *
+ * The kernel must not contain any nodes, and must be configured with the
+ * same number of processes and threads and the same resolution as the
+ * kernel that wrote the checkpoint. Models created by CopyModel need to be
+ * created again before the checkpoint is restored.
+ */
+void read_checkpoint( const std::string& name );
+
+} // namespace nest
+
+#endif /* CHECKPOINT_H */
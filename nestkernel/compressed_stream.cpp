@@ -0,0 +1,102 @@
+/*
+ *  compressed_stream.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "compressed_stream.h"
+
+// C++ includes:
+#include <string>
+
+nest::GzipFileBuffer::GzipFileBuffer( const std::string& filename, int level, size_t buffer_size )
+  : file_( gzopen( filename.c_str(), ( "wb" + std::to_string( level ) ).c_str() ) )
+  , buffer_( buffer_size )
+{
+  if ( file_ )
+  {
+    // zlib buffers the compressed output in addition, so the file is
+    // written in large blocks
+    gzbuffer( file_, buffer_size );
+  }
+  setp( buffer_.data(), buffer_.data() + buffer_.size() );
+}
+
+nest::GzipFileBuffer::~GzipFileBuffer()
+{
+  if ( file_ )
+  {
+    write_buffer_();
+    gzclose( file_ );
+  }
+}
+
+bool
+nest::GzipFileBuffer::is_open() const
+{
+  return file_ != NULL;
+}
+
+bool
+nest::GzipFileBuffer::write_buffer_()
+{
+  const int n = pptr() - pbase();
+  if ( n > 0 and gzwrite( file_, pbase(), n ) != n )
+  {
+    return false;
+  }
+  setp( buffer_.data(), buffer_.data() + buffer_.size() );
+  return true;
+}
+
+nest::GzipFileBuffer::int_type
+nest::GzipFileBuffer::overflow( int_type c )
+{
+  if ( not file_ or not write_buffer_() )
+  {
+    return traits_type::eof();
+  }
+  if ( not traits_type::eq_int_type( c, traits_type::eof() ) )
+  {
+    *pptr() = traits_type::to_char_type( c );
+    pbump( 1 );
+  }
+  return traits_type::not_eof( c );
+}
+
+int
+nest::GzipFileBuffer::sync()
+{
+  if ( not file_ or not write_buffer_() or gzflush( file_, Z_SYNC_FLUSH ) != Z_OK )
+  {
+    return -1;
+  }
+  return 0;
+}
+
+nest::GzipFileStream::GzipFileStream( const std::string& filename, int level, size_t buffer_size )
+  : std::ostream( nullptr )
+  , buffer_( filename, level, buffer_size )
+{
+  rdbuf( &buffer_ );
+  if ( not buffer_.is_open() )
+  {
+    setstate( std::ios::badbit );
+  }
+}
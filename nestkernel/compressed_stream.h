@@ -0,0 +1,88 @@
+/*
+ *  compressed_stream.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMPRESSED_STREAM_H
+#define COMPRESSED_STREAM_H
+
+// C++ includes:
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+// External includes:
+#include <zlib.h>
+
+namespace nest
+{
+
+/**
+ * Stream buffer writing gzip compressed data to a file.
+ *
+ * Characters are collected in a buffer and compressed block-wise when the
+ * buffer is full. sync() compresses the buffer and flushes the compressor
+ * with Z_SYNC_FLUSH, so all data written so far can be decompressed from
+ * the file while it is still open, at the cost of a few bytes of output.
+ */
+class GzipFileBuffer : public std::streambuf
+{
+public:
+  GzipFileBuffer( const std::string& filename, int level, size_t buffer_size );
+  ~GzipFileBuffer();
+
+  GzipFileBuffer( const GzipFileBuffer& ) = delete;
+  GzipFileBuffer& operator=( const GzipFileBuffer& ) = delete;
+
+  //! Return true if the file could be opened
+  bool is_open() const;
+
+protected:
+  int_type overflow( int_type c ) override;
+  int sync() override;
+
+private:
+  //! Compress the buffered characters, return false on failure
+  bool write_buffer_();
+
+  gzFile file_;
+  std::vector< char > buffer_;
+};
+
+/**
+ * Output stream writing a gzip compressed file.
+ *
+ * The stream can be used like a std::ofstream. flush() makes all data
+ * written so far readable from the file, the destructor completes the
+ * file.
+ */
+class GzipFileStream : public std::ostream
+{
+public:
+  GzipFileStream( const std::string& filename, int level, size_t buffer_size = 1 << 16 );
+
+private:
+  GzipFileBuffer buffer_;
+};
+
+} // namespace
+
+#endif // COMPRESSED_STREAM_H
@@ -293,6 +293,16 @@ public:
     return syn_id_delay_.is_disabled();
   }
 
+  /**
+   * Sets the target node without any checks, used when restoring
+   * connections from a checkpoint.
+   */
+  void
+  set_target( Node& target )
+  {
+    target_.set_target( &target );
+  }
+
 protected:
   /**
    * This function calls check_connection() on the sender to check if the
@@ -0,0 +1,86 @@
+/*
+ *  connection_columns.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef CONNECTION_COLUMNS_H
+#define CONNECTION_COLUMNS_H
+
+// C++ includes:
+#include <cstddef>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Connection information stored column-wise in contiguous arrays.
+ *
+ * Entry i of all columns describes the same connection. ConnectionColumns
+ * is filled by ConnectionManager::get_connection_columns() and allows to
+ * retrieve large connectomes without creating a ConnectionDatum for every
+ * connection. The columns weights and delays are only filled if requested,
+ * otherwise they are empty.
+ */
+struct ConnectionColumns
+{
+  std::vector< long > sources;
+  std::vector< long > targets;
+  std::vector< long > target_threads;
+  std::vector< long > synapse_ids;
+  std::vector< long > ports;
+  std::vector< long > receptors;
+  std::vector< double > weights;
+  std::vector< double > delays;
+
+  //! Whether weights and delays are retrieved
+  bool with_weights_and_delays;
+
+  ConnectionColumns()
+    : with_weights_and_delays( false )
+  {
+  }
+
+  size_t
+  size() const
+  {
+    return sources.size();
+  }
+
+  void
+  resize( const size_t n )
+  {
+    sources.resize( n );
+    targets.resize( n );
+    target_threads.resize( n );
+    synapse_ids.resize( n );
+    ports.resize( n );
+    receptors.resize( n );
+    if ( with_weights_and_delays )
+    {
+      weights.resize( n );
+      delays.resize( n );
+    }
+  }
+};
+
+} // namespace nest
+
+#endif /* CONNECTION_COLUMNS_H */
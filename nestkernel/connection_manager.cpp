@@ -31,6 +31,8 @@
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <set>
 #include <vector>
 
@@ -39,6 +41,7 @@
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "clopath_archiving_node.h"
 #include "conn_builder.h"
 #include "conn_builder_factory.h"
@@ -48,6 +51,7 @@
 #include "delay_checker.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "memory_status.h"
 #include "mpi_manager_impl.h"
 #include "nest_names.h"
 #include "node.h"
@@ -178,6 +182,82 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
   def< long >( dict, names::num_connections, n );
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
   def< bool >( dict, names::sort_connections_by_source, sort_connections_by_source_ );
+
+  get_memory_status_( dict );
+}
+
+void
+nest::ConnectionManager::get_memory_status_( DictionaryDatum& dict ) const
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  const synindex num_syn_models = kernel().model_manager.get_num_synapse_prototypes();
+
+  std::vector< long > connections_per_thread( num_threads, 0 );
+  std::vector< long > sources_per_thread( num_threads, 0 );
+  std::vector< long > targets_per_thread( num_threads, 0 );
+  std::vector< long > device_connections_per_thread( num_threads, 0 );
+  std::vector< long > connections_per_syn_model( num_syn_models, 0 );
+  std::vector< long > sources_per_syn_model( num_syn_models, 0 );
+
+  for ( thread tid = 0; tid < static_cast< thread >( connections_.size() ); ++tid )
+  {
+    connections_per_thread[ tid ] = allocated_bytes( connections_[ tid ] );
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      if ( connections_[ tid ][ syn_id ] != NULL )
+      {
+        const size_t bytes = connections_[ tid ][ syn_id ]->get_memory_usage();
+        connections_per_thread[ tid ] += bytes;
+        connections_per_syn_model[ syn_id ] += bytes;
+      }
+      const size_t source_bytes = source_table_.get_memory_usage( tid, syn_id );
+      sources_per_thread[ tid ] += source_bytes;
+      sources_per_syn_model[ syn_id ] += source_bytes;
+    }
+    targets_per_thread[ tid ] = target_table_.get_memory_usage( tid );
+    device_connections_per_thread[ tid ] = target_table_devices_.get_memory_usage( tid );
+  }
+
+  DictionaryDatum connections_per_syn_model_dict( new Dictionary );
+  DictionaryDatum sources_per_syn_model_dict( new Dictionary );
+  for ( synindex syn_id = 0; syn_id < num_syn_models; ++syn_id )
+  {
+    const Name syn_model = kernel().model_manager.get_synapse_prototype( syn_id ).get_name();
+    if ( connections_per_syn_model[ syn_id ] > 0 )
+    {
+      def< long >( connections_per_syn_model_dict, syn_model, connections_per_syn_model[ syn_id ] );
+    }
+    if ( sources_per_syn_model[ syn_id ] > 0 )
+    {
+      def< long >( sources_per_syn_model_dict, syn_model, sources_per_syn_model[ syn_id ] );
+    }
+  }
+
+  def_memory_status( dict, names::connections, connections_per_thread, 0, connections_per_syn_model_dict );
+  def_memory_status( dict, names::source_table, sources_per_thread, 0, sources_per_syn_model_dict );
+  def_memory_status( dict, names::target_table, targets_per_thread );
+  def_memory_status( dict, names::target_table_devices, device_connections_per_thread );
+
+  if ( kernel().mpi_manager.is_dryrun_mode() )
+  {
+    // Connections, the source table and the device tables are built as in
+    // the real simulation. The target table is only filled when the
+    // simulation is prepared, from the source tables of all ranks. Assuming
+    // that sources and connections are evenly distributed across ranks and
+    // threads, each rank stores as many targets as it stores connections.
+    const size_t num_local_nodes = kernel().node_manager.get_max_num_local_nodes() + 1;
+    const size_t num_targets_per_thread = get_num_connections() / num_threads;
+    const long targets_bytes = num_local_nodes * ( sizeof( std::vector< Target > )
+                                                   + sizeof( std::vector< std::vector< size_t > > )
+                                                   + num_syn_models * sizeof( std::vector< size_t > ) )
+      + num_targets_per_thread * sizeof( Target );
+    const std::vector< long > targets_forecast( num_threads, targets_bytes );
+
+    def_memory_forecast( dict, names::connections, connections_per_thread );
+    def_memory_forecast( dict, names::source_table, sources_per_thread );
+    def_memory_forecast( dict, names::target_table, targets_forecast );
+    def_memory_forecast( dict, names::target_table_devices, device_connections_per_thread );
+  }
 }
 
 DictionaryDatum
@@ -316,6 +396,28 @@ nest::ConnectionManager::get_max_delay_time_() const
   return max_delay;
 }
 
+nest::delay
+nest::ConnectionManager::get_shortest_delay() const
+{
+  Time shortest_delay = Time::pos_inf();
+
+  std::vector< DelayChecker >::const_iterator it;
+  for ( it = delay_checkers_.begin(); it != delay_checkers_.end(); ++it )
+  {
+    shortest_delay = std::min( shortest_delay, it->get_shortest_delay() );
+  }
+
+  if ( kernel().mpi_manager.get_num_processes() > 1 )
+  {
+    std::vector< delay > shortest_delays( kernel().mpi_manager.get_num_processes() );
+    shortest_delays[ kernel().mpi_manager.get_rank() ] = shortest_delay.get_steps();
+    kernel().mpi_manager.communicate( shortest_delays );
+    return *std::min_element( shortest_delays.begin(), shortest_delays.end() );
+  }
+
+  return shortest_delay.get_steps();
+}
+
 bool
 nest::ConnectionManager::get_user_set_delay_extrema() const
 {
@@ -482,6 +584,112 @@ nest::ConnectionManager::connect( const index snode_id,
   }
 }
 
+void
+nest::ConnectionManager::connect_arrays( long* sources,
+  long* targets,
+  double* weights,
+  double* delays,
+  std::vector< std::string >& p_keys,
+  double* p_values,
+  size_t n,
+  std::string syn_model )
+{
+  const Token synmodel = kernel().model_manager.get_synapsedict()->lookup( syn_model );
+  if ( synmodel.empty() )
+  {
+    throw UnknownSynapseType( syn_model );
+  }
+  const synindex syn_id = static_cast< size_t >( synmodel );
+
+  // Names of the additional parameters, p_values + k * n points to the
+  // values of parameter p_keys[ k ].
+  std::vector< Name > param_names( p_keys.begin(), p_keys.end() );
+
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( num_threads );
+
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      // First pass: collect the connections with targets on this thread
+      std::vector< size_t > local_connections;
+      for ( size_t i = 0; i < n; ++i )
+      {
+        if ( 0 >= sources[ i ] or static_cast< index >( sources[ i ] ) > kernel().node_manager.size() )
+        {
+          throw UnknownNode( sources[ i ] );
+        }
+        if ( 0 >= targets[ i ] or static_cast< index >( targets[ i ] ) > kernel().node_manager.size() )
+        {
+          throw UnknownNode( targets[ i ] );
+        }
+        if ( not kernel().node_manager.get_node_or_proxy( targets[ i ], tid )->is_proxy() )
+        {
+          local_connections.push_back( i );
+        }
+      }
+
+      // Reserve memory for all local connections at once
+      if ( connections_[ tid ][ syn_id ] == NULL )
+      {
+        connections_[ tid ][ syn_id ] =
+          kernel().model_manager.get_synapse_prototype( syn_id, tid ).create_connector( syn_id );
+      }
+      connections_[ tid ][ syn_id ]->reserve( connections_[ tid ][ syn_id ]->size() + local_connections.size() );
+      source_table_.reserve( tid, syn_id, local_connections.size() );
+
+      // Second pass: create the connections. If weights or delays are not
+      // specified, NaN is passed and replaced by the default value.
+      DictionaryDatum params( new Dictionary );
+      for ( const size_t i : local_connections )
+      {
+        for ( size_t k = 0; k < param_names.size(); ++k )
+        {
+          const double value = p_values[ k * n + i ];
+          // Receptor type must be an integer.
+          if ( param_names[ k ] == names::receptor_type )
+          {
+            const auto int_cast_rtype = static_cast< size_t >( value );
+            if ( int_cast_rtype != value )
+            {
+              throw BadParameter( "Receptor types must be integers." );
+            }
+            ( *params )[ param_names[ k ] ] = int_cast_rtype;
+          }
+          else
+          {
+            ( *params )[ param_names[ k ] ] = value;
+          }
+        }
+
+        connect( sources[ i ],
+          kernel().node_manager.get_node_or_proxy( targets[ i ], tid ),
+          tid,
+          syn_id,
+          params,
+          delays != nullptr ? delays[ i ] : numerics::nan,
+          weights != nullptr ? weights[ i ] : numerics::nan );
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  } // of omp parallel
+
+  // check if any exceptions have been raised
+  for ( thread tid = 0; tid < num_threads; ++tid )
+  {
+    if ( exceptions_raised.at( tid ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
+    }
+  }
+}
+
 // node_id node_id dict syn_id
 bool
 nest::ConnectionManager::connect( const index snode_id,
@@ -736,31 +944,34 @@ nest::ConnectionManager::get_num_connections( const synindex syn_id ) const
   return num_connections;
 }
 
-ArrayDatum
-nest::ConnectionManager::get_connections( const DictionaryDatum& params ) const
+void
+nest::ConnectionManager::get_connections_filter_( const DictionaryDatum& params,
+  NodeCollectionPTR& source,
+  NodeCollectionPTR& target,
+  synindex& syn_id,
+  long& synapse_label ) const
 {
-  std::deque< ConnectionID > connectome;
   const Token& source_t = params->lookup( names::source );
   const Token& target_t = params->lookup( names::target );
   const Token& syn_model_t = params->lookup( names::synapse_model );
-  NodeCollectionPTR source_a = NodeCollectionPTR( 0 );
-  NodeCollectionPTR target_a = NodeCollectionPTR( 0 );
+  source = NodeCollectionPTR( 0 );
+  target = NodeCollectionPTR( 0 );
 
-  long synapse_label = UNLABELED_CONNECTION;
+  synapse_label = UNLABELED_CONNECTION;
   updateValue< long >( params, names::synapse_label, synapse_label );
 
   if ( not source_t.empty() )
   {
-    source_a = getValue< NodeCollectionDatum >( source_t );
-    if ( not source_a->valid() )
+    source = getValue< NodeCollectionDatum >( source_t );
+    if ( not source->valid() )
     {
       throw KernelException( "GetConnection requires valid source NodeCollection." );
     }
   }
   if ( not target_t.empty() )
   {
-    target_a = getValue< NodeCollectionDatum >( target_t );
-    if ( not target_a->valid() )
+    target = getValue< NodeCollectionDatum >( target_t );
+    if ( not target->valid() )
     {
       throw KernelException( "GetConnection requires valid target NodeCollection." );
     }
@@ -781,10 +992,9 @@ nest::ConnectionManager::get_connections( const DictionaryDatum& params ) const
     }
   }
 
-  size_t syn_id = 0;
+  syn_id = invalid_synindex;
 
-  // First we check, whether a synapse model is given.
-  // If not, we will iterate all.
+  // Check whether a synapse model is given.
   if ( not syn_model_t.empty() )
   {
     Name synmodel_name = getValue< Name >( syn_model_t );
@@ -797,6 +1007,22 @@ nest::ConnectionManager::get_connections( const DictionaryDatum& params ) const
     {
       throw UnknownModelName( synmodel_name.toString() );
     }
+  }
+}
+
+ArrayDatum
+nest::ConnectionManager::get_connections( const DictionaryDatum& params ) const
+{
+  std::deque< ConnectionID > connectome;
+  NodeCollectionPTR source_a;
+  NodeCollectionPTR target_a;
+  synindex syn_id;
+  long synapse_label;
+  get_connections_filter_( params, source_a, target_a, syn_id, synapse_label );
+
+  // If no synapse model is given, we iterate all.
+  if ( syn_id != invalid_synindex )
+  {
     get_connections( connectome, source_a, target_a, syn_id, synapse_label );
   }
   else
@@ -819,6 +1045,209 @@ nest::ConnectionManager::get_connections( const DictionaryDatum& params ) const
   return result;
 }
 
+std::vector< nest::index >
+nest::ConnectionManager::get_sorted_node_ids_( NodeCollectionPTR nodecollection ) const
+{
+  std::vector< index > node_ids;
+  if ( nodecollection.get() )
+  {
+    node_ids.reserve( nodecollection->size() );
+    for ( NodeCollection::const_iterator it = nodecollection->begin(); it < nodecollection->end(); ++it )
+    {
+      node_ids.push_back( ( *it ).node_id );
+    }
+    std::sort( node_ids.begin(), node_ids.end() );
+  }
+  return node_ids;
+}
+
+void
+nest::ConnectionManager::get_connection_columns( const DictionaryDatum& params, ConnectionColumns& columns )
+{
+  NodeCollectionPTR source;
+  NodeCollectionPTR target;
+  synindex syn_id;
+  long synapse_label;
+  get_connections_filter_( params, source, target, syn_id, synapse_label );
+
+  if ( is_source_table_cleared() )
+  {
+    throw KernelException(
+      "Invalid attempt to access connection information: source table was "
+      "cleared." );
+  }
+
+  const std::vector< index > requested_sources = get_sorted_node_ids_( source );
+  const std::vector< index > requested_targets = get_sorted_node_ids_( target );
+
+  const synindex first_syn_id = syn_id != invalid_synindex ? syn_id : 0;
+  const synindex end_syn_id =
+    syn_id != invalid_synindex ? syn_id + 1 : kernel().model_manager.get_num_synapse_prototypes();
+
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+
+  // offsets[ t ] is the position of the first connection of thread t in
+  // columns, offsets[ num_threads ] the total number of connections
+  std::vector< size_t > offsets( num_threads + 1, 0 );
+
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+    DictionaryDatum status( new Dictionary );
+
+    // Connections from and to devices are few, we collect them with the
+    // regular mechanism and filter them afterwards.
+    std::deque< ConnectionID > device_connections;
+    for ( synindex s = first_syn_id; s < end_syn_id; ++s )
+    {
+      std::deque< ConnectionID > conns;
+      target_table_devices_.get_connections( 0, 0, tid, s, synapse_label, conns );
+      for ( auto& conn : conns )
+      {
+        if ( ( requested_sources.empty()
+               or std::binary_search( requested_sources.begin(), requested_sources.end(), conn.get_source_node_id() ) )
+          and ( requested_targets.empty()
+                or std::binary_search(
+                     requested_targets.begin(), requested_targets.end(), conn.get_target_node_id() ) ) )
+        {
+          device_connections.push_back( conn );
+        }
+      }
+    }
+
+    // First pass: count matching connections
+    size_t num_connections_in_thread = device_connections.size();
+    for ( synindex s = first_syn_id; s < end_syn_id; ++s )
+    {
+      const ConnectorBase* connections = connections_[ tid ][ s ];
+      if ( connections != NULL )
+      {
+        num_connections_in_thread += connections->get_connection_columns( tid,
+          source_table_.get_thread_local_sources( tid )[ s ],
+          requested_sources,
+          requested_targets,
+          synapse_label,
+          status,
+          NULL,
+          0 );
+      }
+    }
+    offsets[ tid + 1 ] = num_connections_in_thread;
+
+#pragma omp barrier
+#pragma omp single
+    {
+      std::partial_sum( offsets.begin(), offsets.end(), offsets.begin() );
+      columns.resize( offsets[ num_threads ] );
+    } // of omp single; implicit barrier
+
+    // Second pass: write matching connections at the offset of this thread
+    size_t position = offsets[ tid ];
+    for ( synindex s = first_syn_id; s < end_syn_id; ++s )
+    {
+      const ConnectorBase* connections = connections_[ tid ][ s ];
+      if ( connections != NULL )
+      {
+        if ( columns.with_weights_and_delays )
+        {
+          // The model status provides the weight of synapse types with
+          // homogeneous weights, which is not part of the connection status.
+          status->clear();
+          kernel().model_manager.get_synapse_prototype( s, tid ).get_status( status );
+        }
+        position += connections->get_connection_columns( tid,
+          source_table_.get_thread_local_sources( tid )[ s ],
+          requested_sources,
+          requested_targets,
+          synapse_label,
+          status,
+          &columns,
+          position );
+      }
+    }
+
+    for ( auto& conn : device_connections )
+    {
+      columns.sources[ position ] = conn.get_source_node_id();
+      columns.targets[ position ] = conn.get_target_node_id();
+      columns.target_threads[ position ] = conn.get_target_thread();
+      columns.synapse_ids[ position ] = conn.get_synapse_model_id();
+      columns.ports[ position ] = conn.get_port();
+      const DictionaryDatum syn_status = get_synapse_status( conn.get_source_node_id(),
+        conn.get_target_node_id(),
+        conn.get_target_thread(),
+        conn.get_synapse_model_id(),
+        conn.get_port() );
+      columns.receptors[ position ] = getValue< long >( syn_status, names::rport );
+      if ( columns.with_weights_and_delays )
+      {
+        columns.weights[ position ] = getValue< double >( syn_status, names::weight );
+        columns.delays[ position ] = getValue< double >( syn_status, names::delay );
+      }
+      ++position;
+    }
+  } // of omp parallel
+}
+
+void
+nest::ConnectionManager::get_recorded_connections( const thread tid,
+  const index wr_node_id,
+  const std::vector< index >& requested_sources,
+  const std::vector< index >& requested_targets,
+  ConnectionColumns& columns )
+{
+  if ( is_source_table_cleared() )
+  {
+    throw KernelException(
+      "Invalid attempt to access connection information: source table was "
+      "cleared." );
+  }
+
+  std::vector< synindex > recorded_syn_ids;
+  for ( synindex s = 0; s < connections_[ tid ].size(); ++s )
+  {
+    const CommonSynapseProperties& cp = kernel().model_manager.get_synapse_prototype( s, tid ).get_common_properties();
+    if ( connections_[ tid ][ s ] != NULL and cp.get_weight_recorder().get() and cp.get_wr_node_id() == wr_node_id )
+    {
+      recorded_syn_ids.push_back( s );
+    }
+  }
+
+  DictionaryDatum status( new Dictionary );
+  size_t num_connections = 0;
+  for ( auto s : recorded_syn_ids )
+  {
+    num_connections += connections_[ tid ][ s ]->get_connection_columns( tid,
+      source_table_.get_thread_local_sources( tid )[ s ],
+      requested_sources,
+      requested_targets,
+      UNLABELED_CONNECTION,
+      status,
+      NULL,
+      0 );
+  }
+
+  columns.with_weights_and_delays = true;
+  columns.resize( num_connections );
+
+  size_t position = 0;
+  for ( auto s : recorded_syn_ids )
+  {
+    // the model status provides the weight of synapse types with
+    // homogeneous weights
+    status->clear();
+    kernel().model_manager.get_synapse_prototype( s, tid ).get_status( status );
+    position += connections_[ tid ][ s ]->get_connection_columns( tid,
+      source_table_.get_thread_local_sources( tid )[ s ],
+      requested_sources,
+      requested_targets,
+      UNLABELED_CONNECTION,
+      status,
+      &columns,
+      position );
+  }
+}
+
 // Helper method which removes ConnectionIDs from input deque and
 // appends them to output deque.
 static inline std::deque< nest::ConnectionID >&
@@ -1434,3 +1863,183 @@ nest::ConnectionManager::unset_have_connections_changed( const thread tid )
     have_connections_changed_[ tid ].set_false();
   }
 }
+
+void
+nest::ConnectionManager::write_delay_checkpoint( std::ostream& os ) const
+{
+  write_checkpoint_value( os, min_delay_ );
+  write_checkpoint_value( os, max_delay_ );
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    delay_checkers_[ tid ].write_checkpoint( os );
+  }
+}
+
+void
+nest::ConnectionManager::read_delay_checkpoint( std::istream& is )
+{
+  read_checkpoint_value( is, min_delay_ );
+  read_checkpoint_value( is, max_delay_ );
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    delay_checkers_[ tid ].read_checkpoint( is );
+  }
+}
+
+void
+nest::ConnectionManager::write_checkpoint( std::ostream& os )
+{
+  if ( not keep_source_table_ )
+  {
+    throw KernelException( "Checkpoints can only be written if the kernel property keep_source_table is true." );
+  }
+
+  // Entries of the synapse status that do not describe the synapse itself
+  std::vector< Name > connection_entries;
+  connection_entries.push_back( names::source );
+  connection_entries.push_back( names::target );
+  connection_entries.push_back( names::target_thread );
+  connection_entries.push_back( names::synapse_id );
+  connection_entries.push_back( names::synapse_model );
+  connection_entries.push_back( names::port );
+  connection_entries.push_back( names::rport );
+  connection_entries.push_back( names::size_of );
+
+  // Connections from and to devices need to be collected by the thread
+  // they belong to.
+  std::vector< std::deque< ConnectionID > > device_connections( kernel().vp_manager.get_num_threads() );
+  std::vector< std::vector< DictionaryDatum > > device_connection_params( kernel().vp_manager.get_num_threads() );
+#pragma omp parallel
+  {
+    const thread tid = kernel().vp_manager.get_thread_id();
+    for ( synindex syn_id = 0; syn_id < kernel().model_manager.get_num_synapse_prototypes(); ++syn_id )
+    {
+      target_table_devices_.get_connections( 0, 0, tid, syn_id, UNLABELED_CONNECTION, device_connections[ tid ] );
+    }
+
+    for ( std::deque< ConnectionID >::const_iterator it = device_connections[ tid ].begin();
+          it != device_connections[ tid ].end();
+          ++it )
+    {
+      DictionaryDatum params = get_synapse_status(
+        it->get_source_node_id(), it->get_target_node_id(), tid, it->get_synapse_model_id(), it->get_port() );
+
+      // Recorders connect to the data loggers of their targets, which
+      // assigns the rport when the connection is re-created.
+      const Node* source = kernel().node_manager.get_node_or_proxy( it->get_source_node_id(), tid );
+      const long receptor_type =
+        source->get_element_type() == names::recorder ? 0 : getValue< long >( params, names::rport );
+
+      for ( std::vector< Name >::const_iterator name = connection_entries.begin(); name != connection_entries.end();
+            ++name )
+      {
+        params->remove( *name );
+      }
+      def< long >( params, names::receptor_type, receptor_type );
+      device_connection_params[ tid ].push_back( params );
+    }
+  } // of omp parallel
+
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    write_checkpoint_value( os, connections_[ tid ].size() );
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      const ConnectorBase* connector = connections_[ tid ][ syn_id ];
+      write_checkpoint_value( os, connector != NULL );
+      if ( connector == NULL )
+      {
+        continue;
+      }
+
+      write_checkpoint_string( os, kernel().model_manager.get_synapse_prototype( syn_id, tid ).get_name() );
+      source_table_.write_checkpoint( tid, syn_id, os );
+      connector->write_checkpoint( tid, os );
+    }
+
+    write_checkpoint_value( os, device_connections[ tid ].size() );
+    for ( size_t i = 0; i < device_connections[ tid ].size(); ++i )
+    {
+      const ConnectionID& conn = device_connections[ tid ][ i ];
+      write_checkpoint_value( os, static_cast< index >( conn.get_source_node_id() ) );
+      write_checkpoint_value( os, static_cast< index >( conn.get_target_node_id() ) );
+      write_checkpoint_value( os, static_cast< synindex >( conn.get_synapse_model_id() ) );
+      write_checkpoint_dictionary( os, device_connection_params[ tid ][ i ] );
+    }
+  }
+}
+
+void
+nest::ConnectionManager::read_checkpoint( std::istream& is )
+{
+  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    size_t num_connectors;
+    read_checkpoint_value( is, num_connectors );
+    if ( num_connectors > kernel().model_manager.get_num_synapse_prototypes() )
+    {
+      throw KernelException( "Checkpoint contains unknown synapse models." );
+    }
+
+    for ( synindex syn_id = 0; syn_id < num_connectors; ++syn_id )
+    {
+      bool has_connector;
+      read_checkpoint_value( is, has_connector );
+      if ( not has_connector )
+      {
+        continue;
+      }
+
+      std::string synapse_model;
+      read_checkpoint_string( is, synapse_model );
+      ConnectorModel& cm = kernel().model_manager.get_synapse_prototype( syn_id, tid );
+      if ( cm.get_name() != synapse_model )
+      {
+        throw KernelException( String::compose(
+          "Synapse model '%1' of the checkpoint does not match synapse model '%2'.", synapse_model, cm.get_name() ) );
+      }
+
+      source_table_.read_checkpoint( tid, syn_id, is );
+      if ( connections_[ tid ][ syn_id ] == NULL )
+      {
+        connections_[ tid ][ syn_id ] = cm.create_connector( syn_id );
+      }
+      connections_[ tid ][ syn_id ]->read_checkpoint( tid, is );
+
+      if ( num_connections_[ tid ].size() <= syn_id )
+      {
+        num_connections_[ tid ].resize( syn_id + 1 );
+      }
+      num_connections_[ tid ][ syn_id ] = connections_[ tid ][ syn_id ]->size();
+
+      if ( cm.is_primary() )
+      {
+        has_primary_connections_ = true;
+        check_primary_connections_[ tid ].set_true();
+      }
+      else
+      {
+        secondary_connections_exist_ = true;
+        check_secondary_connections_[ tid ].set_true();
+      }
+      set_have_connections_changed( tid );
+    }
+
+    size_t num_device_connections;
+    read_checkpoint_value( is, num_device_connections );
+    for ( size_t i = 0; i < num_device_connections; ++i )
+    {
+      index source_node_id;
+      index target_node_id;
+      synindex syn_id;
+      read_checkpoint_value( is, source_node_id );
+      read_checkpoint_value( is, target_node_id );
+      read_checkpoint_value( is, syn_id );
+      DictionaryDatum params( new Dictionary );
+      read_checkpoint_dictionary( is, params );
+
+      connect( source_node_id, kernel().node_manager.get_node_or_proxy( target_node_id, tid ), tid, syn_id, params );
+    }
+  }
+}
+
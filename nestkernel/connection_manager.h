@@ -24,6 +24,7 @@
 #define CONNECTION_MANAGER_H
 
 // C++ includes:
+#include <iosfwd>
 #include <string>
 
 // Includes from libnestutil:
@@ -31,6 +32,7 @@
 
 // Includes from nestkernel:
 #include "conn_builder.h"
+#include "connection_columns.h"
 #include "connection_id.h"
 #include "connector_base.h"
 #include "node_collection.h"
@@ -133,6 +135,25 @@ public:
     const double_t delay = numerics::nan,
     const double_t weight = numerics::nan );
 
+  /**
+   * Connect arrays of node IDs one-to-one.
+   *
+   * Connects sources[ i ] to targets[ i ] for i < n with synapse model
+   * syn_model. Weights, delays and the additional synapse parameters in
+   * p_keys and p_values are given as in nest::connect_arrays(). Each
+   * thread creates the connections to its local targets and skips all
+   * others, after reserving memory in its connectors and source table for
+   * all of them, so that no reallocation occurs while connecting.
+   */
+  void connect_arrays( long* sources,
+    long* targets,
+    double* weights,
+    double* delays,
+    std::vector< std::string >& p_keys,
+    double* p_values,
+    size_t n,
+    std::string syn_model );
+
   /**
    * Connect two nodes. The source and target nodes are defined by their
    * global ID. The connection is established on the thread/process that owns
@@ -195,6 +216,34 @@ public:
     synindex syn_id,
     long synapse_label ) const;
 
+  /**
+   * Write the connections selected by params to columns.
+   *
+   * params accepts the same entries as for get_connections(). Instead of
+   * a ConnectionDatum per connection, the source and target node IDs,
+   * target threads, synapse IDs, ports and receptors are written to
+   * contiguous arrays, which are filled in parallel by all threads. If
+   * columns.with_weights_and_delays is set, weights and delays are
+   * retrieved as well. Connections are ordered by thread, and within
+   * each thread connections between neurons precede connections from
+   * or to devices.
+   */
+  void get_connection_columns( const DictionaryDatum& params, ConnectionColumns& columns );
+
+  /**
+   * Write the connections of thread tid, whose synapse type records to the
+   * weight recorder with node ID wr_node_id, to columns, including their
+   * weights. The vectors of requested node IDs must be sorted, an empty
+   * vector matches all node IDs. Connections from or to devices are not
+   * included. Only reads thread-local data, so it can be called by all
+   * threads in parallel.
+   */
+  void get_recorded_connections( const thread tid,
+    const index wr_node_id,
+    const std::vector< index >& requested_sources,
+    const std::vector< index >& requested_targets,
+    ConnectionColumns& columns );
+
   /**
    * Returns the number of connections in the network.
    */
@@ -237,6 +286,13 @@ public:
    */
   delay get_max_delay() const;
 
+  /**
+   * Return the shortest delay of all connections across all MPI
+   * processes, irrespective of whether the delay extrema were set by
+   * the user.
+   */
+  delay get_shortest_delay() const;
+
   bool get_user_set_delay_extrema() const;
 
   void
@@ -387,6 +443,26 @@ public:
 
   void set_stdp_eps( const double stdp_eps );
 
+  /**
+   * Write the delay extrema to a checkpoint. They are restored before the
+   * nodes, so that the buffers of the nodes are created with their final
+   * size.
+   */
+  void write_delay_checkpoint( std::ostream& ) const;
+  void read_delay_checkpoint( std::istream& );
+
+  /**
+   * Write all connections to a checkpoint.
+   *
+   * Connections between neurons are stored in their binary representation
+   * together with their sources, connections from and to devices are
+   * stored as parameter dictionaries and re-created via connect().
+   *
+   * @throws KernelException if the source table has been cleared.
+   */
+  void write_checkpoint( std::ostream& );
+  void read_checkpoint( std::istream& );
+
 private:
   size_t get_num_target_data( const thread tid ) const;
 
@@ -395,6 +471,30 @@ private:
   void
   get_source_node_ids_( const thread tid, const synindex syn_id, const index tnode_id, std::vector< index >& sources );
 
+  /**
+   * Add the memory allocated for connections, source table, target table
+   * and connections from and to devices to the memory status in dict.
+   */
+  void get_memory_status_( DictionaryDatum& dict ) const;
+
+  /**
+   * Read source, target, synapse model and label from the params of
+   * GetConnections, and update the connection infrastructure if
+   * connections have changed. If no synapse model is given, syn_id is
+   * set to invalid_synindex.
+   */
+  void get_connections_filter_( const DictionaryDatum& params,
+    NodeCollectionPTR& source,
+    NodeCollectionPTR& target,
+    synindex& syn_id,
+    long& synapse_label ) const;
+
+  /**
+   * Return the sorted node IDs of nodecollection, or an empty vector if
+   * nodecollection is not given.
+   */
+  std::vector< index > get_sorted_node_ids_( NodeCollectionPTR nodecollection ) const;
+
   /**
    * Splits a TokenArray of node IDs to two vectors containing node IDs of neurons and
    * node IDs of devices.
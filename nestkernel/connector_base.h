@@ -27,19 +27,24 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib>
+#include <iosfwd>
 #include <vector>
 
 // Includes from libnestutil:
 #include "compose.hpp"
+#include "numerics.h"
 #include "sort.h"
 #include "vector_util.h"
 
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
+#include "connection_columns.h"
 #include "connection_label.h"
 #include "connector_model.h"
 #include "event.h"
+#include "memory_status.h"
 #include "nest_datums.h"
 #include "nest_names.h"
 #include "node.h"
@@ -124,6 +129,34 @@ public:
     const long synapse_label,
     std::deque< ConnectionID >& conns ) const = 0;
 
+  /**
+   * Write the connections matching the given sources, targets and label
+   * to columns, starting at position, and return their number. The
+   * vectors of requested node IDs must be sorted, an empty vector matches
+   * all node IDs. If columns is NULL, the matching connections are only
+   * counted. If weights are retrieved, the status of each connection is
+   * written to status, which should contain the common properties of the
+   * synapse type to provide weights of homogeneous synapses.
+   */
+  virtual size_t get_connection_columns( const thread tid,
+    const BlockVector< Source >& sources,
+    const std::vector< index >& requested_sources,
+    const std::vector< index >& requested_targets,
+    const long synapse_label,
+    DictionaryDatum& status,
+    ConnectionColumns* columns,
+    const size_t position ) const = 0;
+
+  /**
+   * Allocate memory for at least n connections.
+   */
+  virtual void reserve( const size_t n ) = 0;
+
+  /**
+   * Return the number of bytes allocated by the connector.
+   */
+  virtual size_t get_memory_usage() const = 0;
+
   /**
    * For a given target_node_id add lcids of all connections with matching
    * node ID of target to source_lcids.
@@ -207,6 +240,16 @@ public:
    * Remove disabled connections from the connector.
    */
   virtual void remove_disabled_connections( const index first_disabled_index ) = 0;
+
+  /**
+   * Write all connections to a checkpoint, storing each target as node ID.
+   */
+  virtual void write_checkpoint( const thread tid, std::ostream& os ) const = 0;
+
+  /**
+   * Append the connections stored in a checkpoint. Target nodes must exist.
+   */
+  virtual void read_checkpoint( const thread tid, std::istream& is ) = 0;
 };
 
 /**
@@ -262,6 +305,18 @@ public:
     C_[ lcid ].set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
   }
 
+  void
+  reserve( const size_t n )
+  {
+    C_.reserve( n );
+  }
+
+  size_t
+  get_memory_usage() const
+  {
+    return sizeof( *this ) + allocated_bytes( C_ );
+  }
+
   void
   push_back( const ConnectionT& c )
   {
@@ -326,6 +381,62 @@ public:
     }
   }
 
+  size_t
+  get_connection_columns( const thread tid,
+    const BlockVector< Source >& sources,
+    const std::vector< index >& requested_sources,
+    const std::vector< index >& requested_targets,
+    const long synapse_label,
+    DictionaryDatum& status,
+    ConnectionColumns* columns,
+    const size_t position ) const
+  {
+    size_t num_matching = 0;
+    for ( index lcid = 0; lcid < C_.size(); ++lcid )
+    {
+      const ConnectionT& conn = C_[ lcid ];
+      if ( conn.is_disabled() or ( synapse_label != UNLABELED_CONNECTION and conn.get_label() != synapse_label ) )
+      {
+        continue;
+      }
+
+      const index source_node_id = sources[ lcid ].get_node_id();
+      if ( not requested_sources.empty()
+        and not std::binary_search( requested_sources.begin(), requested_sources.end(), source_node_id ) )
+      {
+        continue;
+      }
+
+      const index target_node_id = conn.get_target( tid )->get_node_id();
+      if ( not requested_targets.empty()
+        and not std::binary_search( requested_targets.begin(), requested_targets.end(), target_node_id ) )
+      {
+        continue;
+      }
+
+      if ( columns != NULL )
+      {
+        const size_t i = position + num_matching;
+        columns->sources[ i ] = source_node_id;
+        columns->targets[ i ] = target_node_id;
+        columns->target_threads[ i ] = tid;
+        columns->synapse_ids[ i ] = syn_id_;
+        columns->ports[ i ] = lcid;
+        columns->receptors[ i ] = conn.get_rport();
+        if ( columns->with_weights_and_delays )
+        {
+          conn.get_status( status );
+          const Token& weight = status->lookup( names::weight );
+          columns->weights[ i ] = weight.empty() ? numerics::nan : getValue< double >( weight );
+          columns->delays[ i ] = conn.get_delay();
+        }
+      }
+      ++num_matching;
+    }
+
+    return num_matching;
+  }
+
   void
   get_source_lcids( const thread tid, const index target_node_id, std::vector< index >& source_lcids ) const
   {
@@ -494,6 +605,10 @@ public:
     assert( C_[ first_disabled_index ].is_disabled() );
     C_.erase( C_.begin() + first_disabled_index, C_.end() );
   }
+
+  // Implemented in connector_base_impl.h
+  void write_checkpoint( const thread tid, std::ostream& os ) const;
+  void read_checkpoint( const thread tid, std::istream& is );
 };
 
 } // of namespace nest
@@ -23,6 +23,7 @@
 #include "connector_base.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "kernel_manager.h"
 
 #ifndef CONNECTOR_BASE_IMPL_H
@@ -61,6 +62,36 @@ Connector< ConnectionT >::send_weight_event( const thread tid,
   }
 }
 
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::write_checkpoint( const thread tid, std::ostream& os ) const
+{
+  write_checkpoint_value( os, C_.size() );
+  for ( size_t lcid = 0; lcid < C_.size(); ++lcid )
+  {
+    write_checkpoint_value( os, C_[ lcid ].get_target( tid )->get_node_id() );
+    write_checkpoint_value( os, C_[ lcid ] );
+  }
+}
+
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::read_checkpoint( const thread tid, std::istream& is )
+{
+  size_t num_connections;
+  read_checkpoint_value( is, num_connections );
+  for ( size_t i = 0; i < num_connections; ++i )
+  {
+    index target_node_id;
+    read_checkpoint_value( is, target_node_id );
+    ConnectionT connection;
+    read_checkpoint_value( is, connection );
+    // the stored target pointer is only valid in the writing kernel
+    connection.set_target( *kernel().node_manager.get_node_or_proxy( target_node_id, tid ) );
+    C_.push_back( connection );
+  }
+}
+
 } // of namespace nest
 
 #endif
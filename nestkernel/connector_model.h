@@ -105,6 +105,11 @@ public:
 
   virtual std::vector< SecondaryEvent* > create_event( size_t n ) const = 0;
 
+  /**
+   * Create an empty connector for connections of this model.
+   */
+  virtual ConnectorBase* create_connector( const synindex syn_id ) const = 0;
+
   std::string
   get_name() const
   {
@@ -236,6 +241,8 @@ public:
 
   void set_syn_id( synindex syn_id );
 
+  ConnectorBase* create_connector( const synindex syn_id ) const;
+
   virtual typename ConnectionT::EventType*
   get_event() const
   {
@@ -252,6 +252,13 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
 }
 
 
+template < typename ConnectionT >
+ConnectorBase*
+GenericConnectorModel< ConnectionT >::create_connector( const synindex syn_id ) const
+{
+  return new Connector< ConnectionT >( syn_id );
+}
+
 template < typename ConnectionT >
 void
 GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
@@ -26,6 +26,7 @@
 #include <algorithm> // min, max
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_timeconverter.h"
@@ -33,6 +34,7 @@
 nest::DelayChecker::DelayChecker()
   : min_delay_( Time::pos_inf() )
   , max_delay_( Time::neg_inf() )
+  , shortest_delay_( Time::pos_inf() )
   , user_set_delay_extrema_( false )
   , freeze_delay_update_( false )
 {
@@ -41,11 +43,13 @@ nest::DelayChecker::DelayChecker()
 nest::DelayChecker::DelayChecker( const DelayChecker& cr )
   : min_delay_( cr.min_delay_ )
   , max_delay_( cr.max_delay_ )
+  , shortest_delay_( cr.shortest_delay_ )
   , user_set_delay_extrema_( cr.user_set_delay_extrema_ )
   , freeze_delay_update_( cr.freeze_delay_update_ )
 {
   min_delay_.calibrate(); // in case of change in resolution
   max_delay_.calibrate();
+  shortest_delay_.calibrate();
 }
 
 void
@@ -55,6 +59,7 @@ nest::DelayChecker::calibrate( const TimeConverter& tc )
   // network elements present.
   min_delay_ = tc.from_old_tics( min_delay_.get_tics() );
   max_delay_ = tc.from_old_tics( max_delay_.get_tics() );
+  shortest_delay_ = tc.from_old_tics( shortest_delay_.get_tics() );
 }
 
 void
@@ -142,6 +147,11 @@ nest::DelayChecker::assert_valid_delay_ms( double requested_new_delay )
     }
   }
 
+  if ( new_delay < shortest_delay_.get_steps() and not freeze_delay_update_ )
+  {
+    shortest_delay_ = Time( Time::step( new_delay ) );
+  }
+
   const bool new_min_delay = new_delay < min_delay_.get_steps();
   const bool new_max_delay = new_delay > max_delay_.get_steps();
 
@@ -207,6 +217,11 @@ nest::DelayChecker::assert_two_valid_delays_steps( delay new_delay1, delay new_d
     }
   }
 
+  if ( ldelay < shortest_delay_.get_steps() and not freeze_delay_update_ )
+  {
+    shortest_delay_ = Time( Time::step( ldelay ) );
+  }
+
   const bool new_min_delay = ldelay < min_delay_.get_steps();
   const bool new_max_delay = hdelay > max_delay_.get_steps();
 
@@ -244,3 +259,21 @@ nest::DelayChecker::assert_two_valid_delays_steps( delay new_delay1, delay new_d
     }
   }
 }
+
+void
+nest::DelayChecker::write_checkpoint( std::ostream& os ) const
+{
+  write_checkpoint_value( os, min_delay_ );
+  write_checkpoint_value( os, max_delay_ );
+  write_checkpoint_value( os, shortest_delay_ );
+  write_checkpoint_value( os, user_set_delay_extrema_ );
+}
+
+void
+nest::DelayChecker::read_checkpoint( std::istream& is )
+{
+  read_checkpoint_value( is, min_delay_ );
+  read_checkpoint_value( is, max_delay_ );
+  read_checkpoint_value( is, shortest_delay_ );
+  read_checkpoint_value( is, user_set_delay_extrema_ );
+}
@@ -23,6 +23,9 @@
 #ifndef DELAY_CHECKER_H
 #define DELAY_CHECKER_H
 
+// C++ includes:
+#include <iosfwd>
+
 // Includes from nestkernel:
 #include "nest_time.h"
 
@@ -43,6 +46,14 @@ public:
 
   const Time& get_max_delay() const;
 
+  /**
+   * Return the shortest delay of all created synapses.
+   *
+   * In contrast to get_min_delay(), this value is tracked also if the
+   * user has set the delay extrema explicitly.
+   */
+  const Time& get_shortest_delay() const;
+
   /**
    * This method freezes the min/ max delay update in SetDefaults of connections
    * method. This is used, when the delay of default connections in the
@@ -85,9 +96,13 @@ public:
   void get_status( DictionaryDatum& ) const;
   void set_status( const DictionaryDatum& );
 
+  void write_checkpoint( std::ostream& ) const;
+  void read_checkpoint( std::istream& );
+
 private:
   Time min_delay_;              //!< Minimal delay of all created synapses.
   Time max_delay_;              //!< Maximal delay of all created synapses.
+  Time shortest_delay_;         //!< Shortest delay of all created synapses.
   bool user_set_delay_extrema_; //!< Flag indicating if the user set the delay
                                 //!< extrema.
   bool freeze_delay_update_;
@@ -105,6 +120,12 @@ DelayChecker::get_max_delay() const
   return max_delay_;
 }
 
+inline const Time&
+DelayChecker::get_shortest_delay() const
+{
+  return shortest_delay_;
+}
+
 inline bool
 DelayChecker::get_user_set_delay_extrema() const
 {
@@ -23,7 +23,11 @@
 #ifndef DEVICE_NODE_H
 #define DEVICE_NODE_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from nestkernel:
+#include "exceptions.h"
 #include "node.h"
 
 namespace nest
@@ -51,6 +55,20 @@ public:
   void set_local_device_id( const index ldid );
   index get_local_device_id() const;
 
+  /**
+   * Replace the stimulus of the device by the stimulus of the next time
+   * slice supplied by a stimulation backend.
+   *
+   * The data holds rows of two values, the time of a stimulus in ms
+   * relative to the origin of the device and its value. Devices that can
+   * be driven by a stimulation backend override this function and must
+   * not throw, as it is called during the simulation. The default
+   * implementation throws KernelException.
+   *
+   * @see StimulationBackend
+   */
+  virtual void set_data_from_stimulation_backend( const std::vector< double >& data );
+
 protected:
   index local_device_id_;
 };
@@ -67,6 +85,12 @@ DeviceNode::get_local_device_id() const
   return local_device_id_;
 }
 
+inline void
+DeviceNode::set_data_from_stimulation_backend( const std::vector< double >& )
+{
+  throw KernelException( "Model " + get_name() + " cannot be driven by a stimulation backend." );
+}
+
 } // namespace
 
 #endif /* #ifndef DEVICE_NODE_H */
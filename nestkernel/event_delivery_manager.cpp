@@ -23,7 +23,7 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // fill, rotate
 #include <iostream>
 #include <numeric> // accumulate
 
@@ -35,6 +35,7 @@
 #include "connection_manager_impl.h"
 #include "event_delivery_manager_impl.h"
 #include "kernel_manager.h"
+#include "memory_status.h"
 #include "mpi_manager_impl.h"
 #include "send_buffer_position.h"
 #include "source.h"
@@ -46,8 +47,29 @@
 
 namespace nest
 {
+#ifdef TIMER_DETAILED
+namespace
+{
+std::vector< double >
+elapsed_per_thread( const std::vector< Stopwatch >& stopwatches )
+{
+  std::vector< double > elapsed;
+  elapsed.reserve( stopwatches.size() );
+  for ( const auto& sw : stopwatches )
+  {
+    elapsed.push_back( sw.elapsed() );
+  }
+  return elapsed;
+}
+}
+#endif
+
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , pipelined_spike_exchange_( false )
+  , spike_data_exchange_pending_( false )
+  , pending_spike_data_origin_()
+  , pending_spike_data_lag_begin_( 0 )
   , moduli_()
   , slice_moduli_()
   , spike_register_()
@@ -86,6 +108,8 @@ EventDeliveryManager::initialize()
   gather_completed_checker_.initialize( num_threads, false );
   // Ensures that ResetKernel resets off_grid_spiking_
   off_grid_spiking_ = false;
+  pipelined_spike_exchange_ = false;
+  spike_data_exchange_pending_ = false;
   buffer_size_target_data_has_changed_ = false;
   buffer_size_spike_data_has_changed_ = false;
 
@@ -120,16 +144,74 @@ void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+
+  bool pipelined_spike_exchange = pipelined_spike_exchange_;
+  updateValue< bool >( dict, names::pipelined_spike_exchange, pipelined_spike_exchange );
+  if ( pipelined_spike_exchange != pipelined_spike_exchange_ )
+  {
+    // the spike registers are only configured before the first call to
+    // simulate
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw BadProperty( "pipelined_spike_exchange cannot be changed after Simulate has been called." );
+    }
+    pipelined_spike_exchange_ = pipelined_spike_exchange;
+  }
 }
 
 void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >( dict, names::pipelined_spike_exchange, pipelined_spike_exchange_ );
   def< double >( dict, names::time_collocate, time_collocate_ );
   def< double >( dict, names::time_communicate, time_communicate_ );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
+
+#ifdef TIMER_DETAILED
+  def< std::vector< double > >( dict, names::time_collocate_spike_data, elapsed_per_thread( sw_collocate_spike_data_ ) );
+  def< std::vector< double > >(
+    dict, names::time_communicate_spike_data, elapsed_per_thread( sw_communicate_spike_data_ ) );
+  def< std::vector< double > >( dict, names::time_deliver_spike_data, elapsed_per_thread( sw_deliver_spike_data_ ) );
+  def< std::vector< double > >(
+    dict, names::time_gather_secondary_events, elapsed_per_thread( sw_gather_secondary_events_ ) );
+  def< std::vector< double > >(
+    dict, names::time_deliver_secondary_events, elapsed_per_thread( sw_deliver_secondary_events_ ) );
+#endif
+
+  std::vector< long > spike_register_per_thread( spike_register_.size() );
+  for ( size_t tid = 0; tid < spike_register_.size(); ++tid )
+  {
+    spike_register_per_thread[ tid ] =
+      allocated_bytes( spike_register_[ tid ] ) + allocated_bytes( off_grid_spike_register_[ tid ] );
+  }
+  def_memory_status( dict, names::spike_register, spike_register_per_thread );
+
+  const long mpi_buffers = allocated_bytes( send_buffer_spike_data_ ) + allocated_bytes( recv_buffer_spike_data_ )
+    + allocated_bytes( send_buffer_off_grid_spike_data_ ) + allocated_bytes( recv_buffer_off_grid_spike_data_ )
+    + allocated_bytes( send_buffer_target_data_ ) + allocated_bytes( recv_buffer_target_data_ )
+    + allocated_bytes( send_buffer_secondary_events_ ) + allocated_bytes( recv_buffer_secondary_events_ );
+  def_memory_status( dict, names::mpi_buffers, std::vector< long >(), mpi_buffers );
+
+  if ( kernel().mpi_manager.is_dryrun_mode() )
+  {
+    // The MPI buffers are allocated when the simulation is prepared, with
+    // at least the sizes currently configured in the MPIManager, see
+    // resize_send_recv_buffers_spike_data_() and init_mpi().
+    const size_t num_processes = kernel().mpi_manager.get_num_processes();
+    const size_t buffer_size_spike_data = std::max( kernel().mpi_manager.get_buffer_size_spike_data(),
+      num_processes * ( kernel().vp_manager.get_num_threads() + 1 ) );
+    const size_t buffer_size_target_data =
+      std::max( kernel().mpi_manager.get_buffer_size_target_data(), 2 * num_processes );
+    const long mpi_buffers_forecast = 2
+      * ( buffer_size_spike_data * ( sizeof( SpikeData ) + sizeof( OffGridSpikeData ) )
+          + buffer_size_target_data * sizeof( TargetData )
+          + kernel().mpi_manager.get_buffer_size_secondary_events_in_int() * sizeof( unsigned int ) );
+
+    def_memory_forecast( dict, names::spike_register, spike_register_per_thread );
+    def_memory_forecast( dict, names::mpi_buffers, std::vector< long >(), mpi_buffers_forecast );
+  }
 }
 
 void
@@ -143,6 +225,15 @@ EventDeliveryManager::resize_send_recv_buffers_target_data()
 void
 EventDeliveryManager::resize_send_recv_buffers_spike_data_()
 {
+  // every chunk needs room for one offset entry per thread and at least
+  // one spike, see partition_spike_data_by_thread_
+  const size_t min_buffer_size =
+    kernel().mpi_manager.get_num_processes() * ( kernel().vp_manager.get_num_threads() + 1 );
+  if ( kernel().mpi_manager.get_buffer_size_spike_data() < min_buffer_size )
+  {
+    kernel().mpi_manager.set_buffer_size_spike_data( min_buffer_size );
+  }
+
   send_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
   recv_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
   send_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
@@ -259,6 +350,15 @@ EventDeliveryManager::reset_timers_counters()
   {
     ( *it ) = 0;
   }
+
+#ifdef TIMER_DETAILED
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  sw_collocate_spike_data_.assign( num_threads, Stopwatch() );
+  sw_communicate_spike_data_.assign( num_threads, Stopwatch() );
+  sw_deliver_spike_data_.assign( num_threads, Stopwatch() );
+  sw_gather_secondary_events_.assign( num_threads, Stopwatch() );
+  sw_deliver_secondary_events_.assign( num_threads, Stopwatch() );
+#endif
 }
 
 void
@@ -275,34 +375,213 @@ EventDeliveryManager::write_done_marker_secondary_events_( const bool done )
 void
 EventDeliveryManager::gather_secondary_events( const bool done )
 {
+#ifdef TIMER_DETAILED
+  // called from within omp single, so only one thread is charged
+  const thread tid = kernel().vp_manager.get_thread_id();
+  sw_gather_secondary_events_[ tid ].start();
+#endif
   write_done_marker_secondary_events_( done );
   kernel().mpi_manager.communicate_secondary_events_Alltoall(
     send_buffer_secondary_events_, recv_buffer_secondary_events_ );
+#ifdef TIMER_DETAILED
+  sw_gather_secondary_events_[ tid ].stop();
+#endif
 }
 
 bool
 EventDeliveryManager::deliver_secondary_events( const thread tid, const bool called_from_wfr_update )
 {
-  return kernel().connection_manager.deliver_secondary_events(
+#ifdef TIMER_DETAILED
+  sw_deliver_secondary_events_[ tid ].start();
+#endif
+  const bool done = kernel().connection_manager.deliver_secondary_events(
     tid, called_from_wfr_update, recv_buffer_secondary_events_ );
+#ifdef TIMER_DETAILED
+  sw_deliver_secondary_events_[ tid ].stop();
+#endif
+  return done;
 }
 
 void
 EventDeliveryManager::gather_spike_data( const thread tid )
 {
+  if ( pipelined_spike_exchange_ )
+  {
+    // the spikes of the previous slice need to be delivered before the
+    // MPI buffers can be reused for the spikes of the current slice
+    complete_pending_spike_data( tid );
+    if ( off_grid_spiking_ )
+    {
+      post_spike_data_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    }
+    else
+    {
+      post_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+    }
+  }
+  else if ( off_grid_spiking_ )
+  {
+    gather_spike_data_(
+      tid, 0, kernel().simulation_manager.get_clock(), send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+  }
+  else
+  {
+    gather_spike_data_( tid, 0, kernel().simulation_manager.get_clock(), send_buffer_spike_data_, recv_buffer_spike_data_ );
+  }
+}
+
+void
+EventDeliveryManager::complete_pending_spike_data( const thread tid )
+{
+  if ( not spike_data_exchange_pending_ )
+  {
+    return;
+  }
+
+  if ( off_grid_spiking_ )
+  {
+    complete_pending_spike_data_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+  }
+  else
+  {
+    complete_pending_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::post_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+#pragma omp single
+  {
+    if ( kernel().mpi_manager.adaptive_spike_buffers() and buffer_size_spike_data_has_changed_ )
+    {
+      resize_send_recv_buffers_spike_data_();
+      buffer_size_spike_data_has_changed_ = false;
+    }
+  } // of omp single; implicit barrier
+
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+  SendBufferPosition send_buffer_position( assigned_ranks,
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank(),
+    kernel().vp_manager.get_num_threads() );
+  const size_t lag_begin = get_spike_register_lag_( 0 );
+
+  // Spikes that do not fit into the send buffer remain in the register
+  // and are exchanged by complete_pending_spike_data_().
+  gather_completed_checker_[ tid ].set_true();
+
+#ifdef TIMER_DETAILED
+  sw_collocate_spike_data_[ tid ].start();
+#endif
+  const bool collocate_completed =
+    collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, lag_begin, spike_register_, send_buffer );
+  gather_completed_checker_[ tid ].logical_and( collocate_completed );
+
   if ( off_grid_spiking_ )
   {
-    gather_spike_data_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    const bool collocate_completed_off_grid = collocate_spike_data_buffers_(
+      tid, assigned_ranks, send_buffer_position, lag_begin, off_grid_spike_register_, send_buffer );
+    gather_completed_checker_[ tid ].logical_and( collocate_completed_off_grid );
+  }
+#ifdef TIMER_DETAILED
+  sw_collocate_spike_data_[ tid ].stop();
+#endif
+
+#pragma omp barrier
+  partition_spike_data_by_thread_( assigned_ranks, send_buffer_position, send_buffer );
+  clean_spike_register_( tid );
+
+  if ( gather_completed_checker_.all_true() )
+  {
+    set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
+#pragma omp barrier
+  }
+
+#pragma omp single
+  {
+#ifdef TIMER_DETAILED
+    sw_communicate_spike_data_[ tid ].start();
+#endif
+    if ( off_grid_spiking_ )
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Ialltoall( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Ialltoall( send_buffer, recv_buffer );
+    }
+#ifdef TIMER_DETAILED
+    sw_communicate_spike_data_[ tid ].stop();
+#endif
+    pending_spike_data_origin_ = kernel().simulation_manager.get_clock();
+    pending_spike_data_lag_begin_ = lag_begin;
+    spike_data_exchange_pending_ = true;
+  } // of omp single; implicit barrier
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::complete_pending_spike_data_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+#pragma omp single
+  {
+#ifdef TIMER_DETAILED
+    sw_communicate_spike_data_[ tid ].start();
+#endif
+    kernel().mpi_manager.wait_for_Ialltoall();
+#ifdef TIMER_DETAILED
+    sw_communicate_spike_data_[ tid ].stop();
+#endif
+  } // of omp single; implicit barrier
+
+  const Time slice_origin = pending_spike_data_origin_;
+  const size_t lag_begin = pending_spike_data_lag_begin_;
+
+#ifdef TIMER_DETAILED
+  sw_deliver_spike_data_[ tid ].start();
+#endif
+  const bool deliver_completed = deliver_events_( tid, slice_origin, recv_buffer );
+  gather_completed_checker_[ tid ].logical_and( deliver_completed );
+#ifdef TIMER_DETAILED
+  sw_deliver_spike_data_[ tid ].stop();
+#endif
+
+  if ( gather_completed_checker_.any_false() )
+  {
+    // Some spikes did not fit into the MPI buffers on at least one
+    // rank. Exchange them in blocking rounds; they are still in time,
+    // as all delays are at least twice min_delay.
+    if ( kernel().mpi_manager.adaptive_spike_buffers() )
+    {
+#pragma omp single
+      {
+        buffer_size_spike_data_has_changed_ = kernel().mpi_manager.increase_buffer_size_spike_data();
+      }
+    }
+    gather_spike_data_( tid, lag_begin, slice_origin, send_buffer, recv_buffer );
   }
   else
   {
-    gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+    reset_spike_register_( tid, lag_begin, lag_begin + kernel().connection_manager.get_min_delay() );
   }
+
+#pragma omp barrier
+#pragma omp single
+  {
+    spike_data_exchange_pending_ = false;
+  } // of omp single; implicit barrier
 }
 
 template < typename SpikeDataT >
 void
 EventDeliveryManager::gather_spike_data_( const thread tid,
+  const size_t lag_begin,
+  const Time& slice_origin,
   std::vector< SpikeDataT >& send_buffer,
   std::vector< SpikeDataT >& recv_buffer )
 {
@@ -328,32 +607,39 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
     } // of omp single; implicit barrier
 
     // Need to get new positions in case buffer size has changed
-    SendBufferPosition send_buffer_position(
-      assigned_ranks, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+    SendBufferPosition send_buffer_position( assigned_ranks,
+      kernel().mpi_manager.get_send_recv_count_spike_data_per_rank(),
+      kernel().vp_manager.get_num_threads() );
 
+#ifdef TIMER_DETAILED
+    sw_collocate_spike_data_[ tid ].start();
+#endif
     // Collocate spikes to send buffer
-    const bool collocate_completed =
-      collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, spike_register_, send_buffer );
+    const bool collocate_completed = collocate_spike_data_buffers_(
+      tid, assigned_ranks, send_buffer_position, lag_begin, spike_register_, send_buffer );
     gather_completed_checker_[ tid ].logical_and( collocate_completed );
 
     if ( off_grid_spiking_ )
     {
       const bool collocate_completed_off_grid = collocate_spike_data_buffers_(
-        tid, assigned_ranks, send_buffer_position, off_grid_spike_register_, send_buffer );
+        tid, assigned_ranks, send_buffer_position, lag_begin, off_grid_spike_register_, send_buffer );
       gather_completed_checker_[ tid ].logical_and( collocate_completed_off_grid );
     }
+#ifdef TIMER_DETAILED
+    sw_collocate_spike_data_[ tid ].stop();
+#endif
 
 #pragma omp barrier
-    // Set markers to signal end of valid spikes, and remove spikes
-    // from register that have been collected in send buffer.
-    set_end_and_invalid_markers_( assigned_ranks, send_buffer_position, send_buffer );
+    // Group spikes by target thread, and remove spikes from register
+    // that have been collected in send buffer.
+    partition_spike_data_by_thread_( assigned_ranks, send_buffer_position, send_buffer );
     clean_spike_register_( tid );
 
     // If we do not have any spikes left, set corresponding marker in
     // send buffer.
     if ( gather_completed_checker_.all_true() )
     {
-      // Needs to be called /after/ set_end_and_invalid_markers_.
+      // Needs to be called /after/ partition_spike_data_by_thread_.
       set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
 #pragma omp barrier
     }
@@ -361,6 +647,9 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
 // Communicate spikes using a single thread.
 #pragma omp single
     {
+#ifdef TIMER_DETAILED
+      sw_communicate_spike_data_[ tid ].start();
+#endif
       if ( off_grid_spiking_ )
       {
         kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
@@ -369,11 +658,20 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
       {
         kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
       }
+#ifdef TIMER_DETAILED
+      sw_communicate_spike_data_[ tid ].stop();
+#endif
     } // of omp single; implicit barrier
 
+#ifdef TIMER_DETAILED
+    sw_deliver_spike_data_[ tid ].start();
+#endif
     // Deliver spikes from receive buffer to ring buffers.
-    const bool deliver_completed = deliver_events_( tid, recv_buffer );
+    const bool deliver_completed = deliver_events_( tid, slice_origin, recv_buffer );
     gather_completed_checker_[ tid ].logical_and( deliver_completed );
+#ifdef TIMER_DETAILED
+    sw_deliver_spike_data_[ tid ].stop();
+#endif
 
 // Exit gather loop if all local threads and remote processes are
 // done.
@@ -390,7 +688,7 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
 
   } // of while
 
-  reset_spike_register_( tid );
+  reset_spike_register_( tid, lag_begin, lag_begin + kernel().connection_manager.get_min_delay() );
 }
 
 template < typename TargetT, typename SpikeDataT >
@@ -398,6 +696,7 @@ bool
 EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   const AssignedRanks& assigned_ranks,
   SendBufferPosition& send_buffer_position,
+  const size_t lag_begin,
   std::vector< std::vector< std::vector< std::vector< TargetT > > > >& spike_register,
   std::vector< SpikeDataT >& send_buffer )
 {
@@ -415,12 +714,12 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
   {
     // Second dimension: fixed reading thread
 
-    // Third dimension: loop over lags
-    for ( unsigned int lag = 0; lag < ( *it )[ tid ].size(); ++lag )
+    // Third dimension: loop over lags of one slice
+    for ( unsigned int lag = 0; lag < ( unsigned int ) kernel().connection_manager.get_min_delay(); ++lag )
     {
       // Fourth dimension: loop over entries
-      for ( typename std::vector< TargetT >::iterator iiit = ( *it )[ tid ][ lag ].begin();
-            iiit < ( *it )[ tid ][ lag ].end();
+      for ( typename std::vector< TargetT >::iterator iiit = ( *it )[ tid ][ lag_begin + lag ].begin();
+            iiit < ( *it )[ tid ][ lag_begin + lag ].end();
             ++iiit )
       {
         assert( not iiit->is_processed() );
@@ -455,30 +754,58 @@ EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
 
 template < typename SpikeDataT >
 void
-EventDeliveryManager::set_end_and_invalid_markers_( const AssignedRanks& assigned_ranks,
+EventDeliveryManager::partition_spike_data_by_thread_( const AssignedRanks& assigned_ranks,
   const SendBufferPosition& send_buffer_position,
   std::vector< SpikeDataT >& send_buffer )
 {
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< unsigned int > thread_end( num_threads );
+  std::vector< SpikeDataT > unsorted;
+
   for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
   {
-    // thread-local index of (global) rank
-    if ( send_buffer_position.idx( rank ) > send_buffer_position.begin( rank ) )
+    const unsigned int chunk_begin = send_buffer_position.begin( rank );
+    const unsigned int data_begin = chunk_begin + num_threads;
+    const unsigned int data_end = send_buffer_position.idx( rank );
+    assert( data_begin <= data_end );
+
+    // Count spikes per target thread; the segment of thread t then
+    // starts where the segment of thread t - 1 ends (offsets relative
+    // to chunk_begin).
+    std::fill( thread_end.begin(), thread_end.end(), 0 );
+    for ( unsigned int i = data_begin; i < data_end; ++i )
     {
-      // Set end marker at last position that contains a valid
-      // entry. This could possibly be the last entry in this
-      // chunk. Since we call set_complete_marker_spike_data_ /after/
-      // this function, the end marker would be replaced by a complete
-      // marker. However, the effect of an end marker and a complete
-      // marker /at the last position in a chunk/ leads effectively
-      // to the same behavior: after this entry, the first entry of
-      // the next chunk is read, i.e., the next element in the buffer.
-      assert( send_buffer_position.idx( rank ) - 1 < send_buffer_position.end( rank ) );
-      send_buffer[ send_buffer_position.idx( rank ) - 1 ].set_end_marker();
+      ++thread_end[ send_buffer[ i ].get_tid() ];
+    }
+    unsigned int segment_begin = num_threads;
+    for ( thread t = 0; t < num_threads; ++t )
+    {
+      const unsigned int num_spikes = thread_end[ t ];
+      thread_end[ t ] = segment_begin;
+      segment_begin += num_spikes;
+    }
+
+    // Stable counting sort, such that each thread delivers its spikes in
+    // the same order as before. With a single thread, the chunk is
+    // already sorted.
+    if ( num_threads > 1 )
+    {
+      unsorted.assign( send_buffer.begin() + data_begin, send_buffer.begin() + data_end );
+      for ( typename std::vector< SpikeDataT >::const_iterator it = unsorted.begin(); it != unsorted.end(); ++it )
+      {
+        send_buffer[ chunk_begin + thread_end[ it->get_tid() ]++ ] = *it;
+      }
     }
     else
     {
-      assert( send_buffer_position.idx( rank ) == send_buffer_position.begin( rank ) );
-      send_buffer[ send_buffer_position.begin( rank ) ].set_invalid_marker();
+      thread_end[ 0 ] = data_end - chunk_begin;
+    }
+
+    // The header entry of thread t holds the end of its segment in the
+    // lcid field.
+    for ( thread t = 0; t < num_threads; ++t )
+    {
+      send_buffer[ chunk_begin + t ].set( t, 0, thread_end[ t ], 0, 0. );
     }
   }
 }
@@ -504,8 +831,8 @@ EventDeliveryManager::set_complete_marker_spike_data_( const AssignedRanks& assi
 {
   for ( thread target_rank = assigned_ranks.begin; target_rank < assigned_ranks.end; ++target_rank )
   {
-    // Use last entry for completion marker. For possible collision
-    // with end marker, see comment in set_end_and_invalid_markers_.
+    // Use last entry for completion marker. This entry may hold a
+    // valid spike, which is not affected by the marker.
     const thread idx = send_buffer_position.end( target_rank ) - 1;
     send_buffer[ idx ].set_complete_marker();
   }
@@ -513,7 +840,9 @@ EventDeliveryManager::set_complete_marker_spike_data_( const AssignedRanks& assi
 
 template < typename SpikeDataT >
 bool
-EventDeliveryManager::deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer )
+EventDeliveryManager::deliver_events_( const thread tid,
+  const Time& slice_origin,
+  const std::vector< SpikeDataT >& recv_buffer )
 {
   const unsigned int send_recv_count_spike_data_per_rank =
     kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
@@ -521,8 +850,9 @@ EventDeliveryManager::deliver_events_( const thread tid, const std::vector< Spik
 
   bool are_others_completed = true;
 
-  // deliver only at end of time slice
-  assert( kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
+  // deliver only at end of time slice, or after the slice in pipelined mode
+  assert( pipelined_spike_exchange_
+    or kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
 
   SpikeEvent se;
 
@@ -530,46 +860,39 @@ EventDeliveryManager::deliver_events_( const thread tid, const std::vector< Spik
   std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
   for ( size_t lag = 0; lag < ( size_t ) kernel().connection_manager.get_min_delay(); ++lag )
   {
-    prepared_timestamps[ lag ] = kernel().simulation_manager.get_clock() + Time::step( lag + 1 );
+    prepared_timestamps[ lag ] = slice_origin + Time::step( lag + 1 );
   }
 
   for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
   {
-    // check last entry for completed marker; needs to be done before
-    // checking invalid marker to assure that this is always read
-    if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank - 1 ].is_complete_marker() )
+    const unsigned int chunk_begin = rank * send_recv_count_spike_data_per_rank;
+
+    // check last entry for completed marker
+    if ( not recv_buffer[ chunk_begin + send_recv_count_spike_data_per_rank - 1 ].is_complete_marker() )
     {
       are_others_completed = false;
     }
 
-    // continue with next rank if no spikes were sent by this rank
-    if ( recv_buffer[ rank * send_recv_count_spike_data_per_rank ].is_invalid_marker() )
-    {
-      continue;
-    }
+    // read only the segment of this thread, see
+    // partition_spike_data_by_thread_
+    const unsigned int segment_begin =
+      chunk_begin + ( tid == 0 ? kernel().vp_manager.get_num_threads() : recv_buffer[ chunk_begin + tid - 1 ].get_lcid() );
+    const unsigned int segment_end = chunk_begin + recv_buffer[ chunk_begin + tid ].get_lcid();
 
-    for ( unsigned int i = 0; i < send_recv_count_spike_data_per_rank; ++i )
+    for ( unsigned int i = segment_begin; i < segment_end; ++i )
     {
-      const SpikeDataT& spike_data = recv_buffer[ rank * send_recv_count_spike_data_per_rank + i ];
+      const SpikeDataT& spike_data = recv_buffer[ i ];
+      assert( spike_data.get_tid() == tid );
 
-      if ( spike_data.get_tid() == tid )
-      {
-        se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
-        se.set_offset( spike_data.get_offset() );
+      se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+      se.set_offset( spike_data.get_offset() );
 
-        const index syn_id = spike_data.get_syn_id();
-        const index lcid = spike_data.get_lcid();
-        const index source_node_id = kernel().connection_manager.get_source_node_id( tid, syn_id, lcid );
-        se.set_sender_node_id( source_node_id );
+      const index syn_id = spike_data.get_syn_id();
+      const index lcid = spike_data.get_lcid();
+      const index source_node_id = kernel().connection_manager.get_source_node_id( tid, syn_id, lcid );
+      se.set_sender_node_id( source_node_id );
 
-        kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
-      }
-
-      // break if this was the last valid entry from this rank
-      if ( spike_data.is_end_marker() )
-      {
-        break;
-      }
+      kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
     }
   }
 
@@ -782,7 +1105,7 @@ EventDeliveryManager::resize_spike_register_( const thread tid )
         it != spike_register_[ tid ].end();
         ++it )
   {
-    it->resize( kernel().connection_manager.get_min_delay(), std::vector< Target >() );
+    it->resize( get_spike_register_num_lags_(), std::vector< Target >() );
   }
 
   for (
@@ -790,8 +1113,14 @@ EventDeliveryManager::resize_spike_register_( const thread tid )
     it != off_grid_spike_register_[ tid ].end();
     ++it )
   {
-    it->resize( kernel().connection_manager.get_min_delay(), std::vector< OffGridTarget >() );
+    it->resize( get_spike_register_num_lags_(), std::vector< OffGridTarget >() );
   }
 }
 
+delay
+EventDeliveryManager::get_spike_register_num_lags_() const
+{
+  return ( pipelined_spike_exchange_ ? 2 : 1 ) * kernel().connection_manager.get_min_delay();
+}
+
 } // of namespace nest
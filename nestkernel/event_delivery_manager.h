@@ -145,6 +145,12 @@ public:
    */
   void set_off_grid_communication( bool off_grid_spiking );
 
+  /**
+   * Return whether spike data of one slice is exchanged during the
+   * update of the next slice.
+   */
+  bool get_pipelined_spike_exchange() const;
+
   /**
    * Return 0 for even, 1 for odd time slices.
    *
@@ -195,9 +201,21 @@ public:
   /**
    * Collocates spikes from register to MPI buffers, communicates via
    * MPI and delivers events to targets.
+   *
+   * If pipelined_spike_exchange is set, the spikes of the current slice
+   * are only handed to a non-blocking Alltoall, which completes at the end
+   * of the next slice. The spikes of the previous slice are delivered
+   * instead. This is only valid if all delays are at least twice min_delay,
+   * which SimulationManager::prepare() ensures.
    */
   void gather_spike_data( const thread tid );
 
+  /**
+   * Complete a pending non-blocking spike exchange and deliver the spikes.
+   * Called at the end of each call to simulate in pipelined mode.
+   */
+  void complete_pending_spike_data( const thread tid );
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
@@ -236,8 +254,34 @@ public:
   virtual void reset_timers_counters();
 
 private:
+  /**
+   * Exchange the spikes stored at lags lag_begin to lag_begin + min_delay
+   * of the spike register in blocking communication rounds until all spikes
+   * are delivered. The spikes were emitted in the slice starting at
+   * slice_origin.
+   */
   template < typename SpikeDataT >
   void gather_spike_data_( const thread tid,
+    const size_t lag_begin,
+    const Time& slice_origin,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Collocate the spikes of the current slice and start a non-blocking
+   * exchange of a single round.
+   */
+  template < typename SpikeDataT >
+  void post_spike_data_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Wait for the pending non-blocking exchange, deliver its spikes and
+   * exchange any spikes that did not fit into the MPI buffers.
+   */
+  template < typename SpikeDataT >
+  void complete_pending_spike_data_( const thread tid,
     std::vector< SpikeDataT >& send_buffer,
     std::vector< SpikeDataT >& recv_buffer );
 
@@ -251,14 +295,18 @@ private:
   bool collocate_spike_data_buffers_( const thread tid,
     const AssignedRanks& assigned_ranks,
     SendBufferPosition& send_buffer_position,
+    const size_t lag_begin,
     std::vector< std::vector< std::vector< std::vector< TargetT > > > >& spike_register,
     std::vector< SpikeDataT >& send_buffer );
 
   /**
-   * Marks end of valid regions in MPI buffers.
+   * Groups the spikes in each chunk of the MPI buffer by target thread
+   * and writes the end of each thread's segment into the first entries
+   * of the chunk, such that each thread reads only its own segment in
+   * deliver_events_().
    */
   template < typename SpikeDataT >
-  void set_end_and_invalid_markers_( const AssignedRanks& assigned_ranks,
+  void partition_spike_data_by_thread_( const AssignedRanks& assigned_ranks,
     const SendBufferPosition& send_buffer_position,
     std::vector< SpikeDataT >& send_buffer );
 
@@ -285,7 +333,7 @@ private:
    * nodes.
    */
   template < typename SpikeDataT >
-  bool deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer );
+  bool deliver_events_( const thread tid, const Time& slice_origin, const std::vector< SpikeDataT >& recv_buffer );
 
   /**
    * Deletes all spikes from spike registers and resets spike
@@ -293,6 +341,23 @@ private:
    */
   void reset_spike_register_( const thread tid );
 
+  /**
+   * Deletes spikes at lags lag_begin to lag_end (exclusive) from spike
+   * registers.
+   */
+  void reset_spike_register_( const thread tid, const size_t lag_begin, const size_t lag_end );
+
+  /**
+   * Return the lag dimension of the spike registers; twice min_delay in
+   * pipelined mode.
+   */
+  delay get_spike_register_num_lags_() const;
+
+  /**
+   * Map lag within the current slice to lag in spike register.
+   */
+  long get_spike_register_lag_( const long lag ) const;
+
   /**
    * Resizes spike registers according minimal delay so it can
    * accommodate all possible lags.
@@ -350,6 +415,18 @@ private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  //! whether spikes are exchanged overlapping with the next slice
+  bool pipelined_spike_exchange_;
+
+  //! whether a non-blocking spike exchange has been started, but not completed
+  bool spike_data_exchange_pending_;
+
+  //! origin of slice in which the spikes of the pending exchange were emitted
+  Time pending_spike_data_origin_;
+
+  //! first lag in spike register of the spikes of the pending exchange
+  size_t pending_spike_data_lag_begin_;
+
   /**
    * Table of pre-computed modulos.
    * This table is used to map time steps, given as offset from now,
@@ -421,6 +498,16 @@ private:
    */
   std::vector< unsigned long > local_spike_counter_;
 
+#ifdef TIMER_DETAILED
+  // Per-thread timers for the phases of spike and secondary event
+  // exchange, reset together with the counters above.
+  std::vector< Stopwatch > sw_collocate_spike_data_;
+  std::vector< Stopwatch > sw_communicate_spike_data_;
+  std::vector< Stopwatch > sw_deliver_spike_data_;
+  std::vector< Stopwatch > sw_gather_secondary_events_;
+  std::vector< Stopwatch > sw_deliver_secondary_events_;
+#endif
+
   std::vector< SpikeData > send_buffer_spike_data_;
   std::vector< SpikeData > recv_buffer_spike_data_;
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
@@ -436,6 +523,31 @@ private:
   PerThreadBoolIndicator gather_completed_checker_;
 };
 
+inline void
+EventDeliveryManager::reset_spike_register_( const thread tid, const size_t lag_begin, const size_t lag_end )
+{
+  for ( std::vector< std::vector< std::vector< Target > > >::iterator it = spike_register_[ tid ].begin();
+        it < spike_register_[ tid ].end();
+        ++it )
+  {
+    for ( size_t lag = lag_begin; lag < lag_end; ++lag )
+    {
+      ( *it )[ lag ].clear();
+    }
+  }
+
+  for (
+    std::vector< std::vector< std::vector< OffGridTarget > > >::iterator it = off_grid_spike_register_[ tid ].begin();
+    it < off_grid_spike_register_[ tid ].end();
+    ++it )
+  {
+    for ( size_t lag = lag_begin; lag < lag_end; ++lag )
+    {
+      ( *it )[ lag ].clear();
+    }
+  }
+}
+
 inline void
 EventDeliveryManager::reset_spike_register_( const thread tid )
 {
@@ -512,6 +624,12 @@ EventDeliveryManager::set_off_grid_communication( bool off_grid_spiking )
   off_grid_spiking_ = off_grid_spiking;
 }
 
+inline bool
+EventDeliveryManager::get_pipelined_spike_exchange() const
+{
+  return pipelined_spike_exchange_;
+}
+
 inline size_t
 EventDeliveryManager::read_toggle() const
 {
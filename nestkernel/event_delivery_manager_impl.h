@@ -106,6 +106,7 @@ EventDeliveryManager::send_remote( thread tid, SpikeEvent& e, const long lag )
   // Put the spike in a buffer for the remote machines
   const index lid = kernel().vp_manager.node_id_to_lid( e.get_sender().get_node_id() );
   const std::vector< Target >& targets = kernel().connection_manager.get_remote_targets_of_local_node( tid, lid );
+  const long register_lag = get_spike_register_lag_( lag );
 
   for ( std::vector< Target >::const_iterator it = targets.begin(); it != targets.end(); ++it )
   {
@@ -114,7 +115,7 @@ EventDeliveryManager::send_remote( thread tid, SpikeEvent& e, const long lag )
     // Unroll spike multiplicity as plastic synapses only handle individual spikes.
     for ( int i = 0; i < e.get_multiplicity(); ++i )
     {
-      spike_register_[ tid ][ assigned_tid ][ lag ].push_back( *it );
+      spike_register_[ tid ][ assigned_tid ][ register_lag ].push_back( *it );
     }
   }
 }
@@ -125,6 +126,7 @@ EventDeliveryManager::send_off_grid_remote( thread tid, SpikeEvent& e, const lon
   // Put the spike in a buffer for the remote machines
   const index lid = kernel().vp_manager.node_id_to_lid( e.get_sender().get_node_id() );
   const std::vector< Target >& targets = kernel().connection_manager.get_remote_targets_of_local_node( tid, lid );
+  const long register_lag = get_spike_register_lag_( lag );
 
   for ( std::vector< Target >::const_iterator it = targets.begin(); it != targets.end(); ++it )
   {
@@ -133,7 +135,7 @@ EventDeliveryManager::send_off_grid_remote( thread tid, SpikeEvent& e, const lon
     // Unroll spike multiplicity as plastic synapses only handle individual spikes.
     for ( int i = 0; i < e.get_multiplicity(); ++i )
     {
-      off_grid_spike_register_[ tid ][ assigned_tid ][ lag ].push_back( OffGridTarget( *it, e.get_offset() ) );
+      off_grid_spike_register_[ tid ][ assigned_tid ][ register_lag ].push_back( OffGridTarget( *it, e.get_offset() ) );
     }
   }
 }
@@ -180,6 +182,18 @@ EventDeliveryManager::write_toggle() const
   return kernel().simulation_manager.get_slice() % 2;
 }
 
+inline long
+EventDeliveryManager::get_spike_register_lag_( const long lag ) const
+{
+  // in pipelined mode, even and odd slices use separate halves of the
+  // register, see gather_spike_data()
+  if ( pipelined_spike_exchange_ )
+  {
+    return lag + write_toggle() * kernel().connection_manager.get_min_delay();
+  }
+  return lag;
+}
+
 
 } // of namespace nest
 
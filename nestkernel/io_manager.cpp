@@ -40,8 +40,12 @@
 // Includes from nestkernel:
 #include "kernel_manager.h"
 #include "recording_backend_ascii.h"
+#include "recording_backend_binary.h"
 #include "recording_backend_memory.h"
 #include "recording_backend_screen.h"
+#include "recording_backend_shared_memory.h"
+#include "recording_device.h"
+#include "stimulation_backend_file.h"
 #ifdef HAVE_RECORDINGBACKEND_ARBOR
 #include "recording_backend_arbor.h"
 #endif
@@ -59,6 +63,7 @@ IOManager::IOManager()
   : overwrite_files_( false )
 {
   register_recording_backends_();
+  register_stimulation_backends_();
 }
 
 IOManager::~IOManager()
@@ -67,6 +72,10 @@ IOManager::~IOManager()
   {
     delete it.second;
   }
+  for ( auto& it : stimulation_backends_ )
+  {
+    delete it.second;
+  }
 }
 
 void
@@ -135,28 +144,48 @@ IOManager::initialize()
 
   overwrite_files_ = false;
 
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::vector< RecordingDevice* > >( num_threads ).swap( buffering_recorders_ );
+
   for ( const auto& it : recording_backends_ )
   {
     it.second->initialize();
   }
+  for ( const auto& it : stimulation_backends_ )
+  {
+    it.second->initialize();
+  }
 }
 
 void
 IOManager::finalize()
 {
+  buffering_recorders_.clear();
+
   for ( const auto& it : recording_backends_ )
   {
     it.second->finalize();
   }
+  for ( const auto& it : stimulation_backends_ )
+  {
+    it.second->finalize();
+  }
 }
 
-void IOManager::change_num_threads( thread )
+void IOManager::change_num_threads( thread num_threads )
 {
+  std::vector< std::vector< RecordingDevice* > >( num_threads ).swap( buffering_recorders_ );
+
   for ( const auto& it : recording_backends_ )
   {
     it.second->finalize();
     it.second->initialize();
   }
+  for ( const auto& it : stimulation_backends_ )
+  {
+    it.second->finalize();
+    it.second->initialize();
+  }
 }
 
 void
@@ -178,6 +207,19 @@ IOManager::set_status( const DictionaryDatum& d )
       }
     }
   }
+
+  DictionaryDatum stimulation_backends;
+  if ( updateValue< DictionaryDatum >( d, names::stimulation_backends, stimulation_backends ) )
+  {
+    for ( const auto& it : stimulation_backends_ )
+    {
+      DictionaryDatum stimulation_backend_status;
+      if ( updateValue< DictionaryDatum >( stimulation_backends, it.first, stimulation_backend_status ) )
+      {
+        it.second->set_status( stimulation_backend_status );
+      }
+    }
+  }
 }
 
 void
@@ -195,6 +237,15 @@ IOManager::get_status( DictionaryDatum& d )
     ( *recording_backends )[ it.first ] = recording_backend_status;
   }
   ( *d )[ names::recording_backends ] = recording_backends;
+
+  DictionaryDatum stimulation_backends( new Dictionary );
+  for ( const auto& it : stimulation_backends_ )
+  {
+    DictionaryDatum stimulation_backend_status( new Dictionary );
+    it.second->get_status( stimulation_backend_status );
+    ( *stimulation_backends )[ it.first ] = stimulation_backend_status;
+  }
+  ( *d )[ names::stimulation_backends ] = stimulation_backends;
 }
 
 void
@@ -204,6 +255,10 @@ IOManager::pre_run_hook()
   {
     it.second->pre_run_hook();
   }
+  for ( auto& it : stimulation_backends_ )
+  {
+    it.second->pre_run_hook();
+  }
 }
 
 void
@@ -213,15 +268,30 @@ IOManager::post_run_hook()
   {
     it.second->post_run_hook();
   }
+  for ( auto& it : stimulation_backends_ )
+  {
+    it.second->post_run_hook();
+  }
 }
 
 void
 IOManager::post_step_hook()
 {
+  // write the records collected during the time slice, so that the
+  // backends find them in their post_step_hook()
+  for ( auto& device : buffering_recorders_[ kernel().vp_manager.get_thread_id() ] )
+  {
+    device->write_buffered_records();
+  }
+
   for ( auto& it : recording_backends_ )
   {
     it.second->post_step_hook();
   }
+  for ( auto& it : stimulation_backends_ )
+  {
+    it.second->post_step_hook();
+  }
 }
 
 void
@@ -231,6 +301,10 @@ IOManager::prepare()
   {
     it.second->prepare();
   }
+  for ( auto& it : stimulation_backends_ )
+  {
+    it.second->prepare();
+  }
 }
 
 void
@@ -240,6 +314,10 @@ IOManager::cleanup()
   {
     it.second->cleanup();
   }
+  for ( auto& it : stimulation_backends_ )
+  {
+    it.second->cleanup();
+  }
 }
 
 bool
@@ -260,6 +338,18 @@ IOManager::write( Name backend_name,
   recording_backends_[ backend_name ]->write( device, event, double_values, long_values );
 }
 
+void
+IOManager::write_spikes( Name backend_name, const RecordingDevice& device, const std::vector< RecordedSpike >& spikes )
+{
+  recording_backends_[ backend_name ]->write_spikes( device, spikes );
+}
+
+void
+IOManager::register_buffering_recorder( RecordingDevice& device )
+{
+  buffering_recorders_[ device.get_thread() ].push_back( &device );
+}
+
 void
 IOManager::enroll_recorder( Name backend_name, const RecordingDevice& device, const DictionaryDatum& params )
 {
@@ -303,12 +393,72 @@ IOManager::get_recording_backend_device_status( Name backend_name, const Recordi
   recording_backends_[ backend_name ]->get_device_status( device, d );
 }
 
+void
+IOManager::get_recording_backend_device_columns( Name backend_name,
+  const RecordingDevice& device,
+  const bool drain,
+  RecordingColumns& columns )
+{
+  recording_backends_[ backend_name ]->get_device_columns( device, drain, columns );
+}
+
+bool
+IOManager::is_valid_stimulation_backend( Name backend_name ) const
+{
+  return stimulation_backends_.find( backend_name ) != stimulation_backends_.end();
+}
+
+void
+IOManager::enroll_stimulator( Name backend_name,
+  DeviceNode& node,
+  const Device& device,
+  const DictionaryDatum& params )
+{
+  for ( auto& it : stimulation_backends_ )
+  {
+    if ( it.first == backend_name )
+    {
+      it.second->enroll( node, device, params );
+    }
+    else
+    {
+      it.second->disenroll( node );
+    }
+  }
+}
+
+void
+IOManager::check_stimulation_backend_device_status( const DictionaryDatum& params )
+{
+  for ( const auto& it : stimulation_backends_ )
+  {
+    it.second->check_device_status( params );
+  }
+}
+
+void
+IOManager::get_stimulation_backend_device_defaults( DictionaryDatum& params )
+{
+  for ( const auto& it : stimulation_backends_ )
+  {
+    it.second->get_device_defaults( params );
+  }
+}
+
+void
+IOManager::get_stimulation_backend_device_status( Name backend_name, const DeviceNode& node, DictionaryDatum& d )
+{
+  stimulation_backends_[ backend_name ]->get_device_status( node, d );
+}
+
 void
 IOManager::register_recording_backends_()
 {
   recording_backends_.insert( std::make_pair( "ascii", new RecordingBackendASCII() ) );
+  recording_backends_.insert( std::make_pair( "binary", new RecordingBackendBinary() ) );
   recording_backends_.insert( std::make_pair( "memory", new RecordingBackendMemory() ) );
   recording_backends_.insert( std::make_pair( "screen", new RecordingBackendScreen() ) );
+  recording_backends_.insert( std::make_pair( "shared_memory", new RecordingBackendSharedMemory() ) );
 #ifdef HAVE_RECORDINGBACKEND_ARBOR
   recording_backends_.insert( std::make_pair( "arbor", new RecordingBackendArbor() ) );
 #endif
@@ -317,4 +467,10 @@ IOManager::register_recording_backends_()
 #endif
 }
 
+void
+IOManager::register_stimulation_backends_()
+{
+  stimulation_backends_.insert( std::make_pair( "file", new StimulationBackendFile() ) );
+}
+
 } // namespace nest
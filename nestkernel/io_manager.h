@@ -25,11 +25,13 @@
 
 // C++ includes:
 #include <string>
+#include <vector>
 
 // Includes from libnestutil:
 #include "manager_interface.h"
 
 #include "recording_backend.h"
+#include "stimulation_backend.h"
 
 namespace nest
 {
@@ -74,20 +76,21 @@ public:
   bool overwrite_files() const;
 
   /**
-   * Clean up in all registered recording backends after a single call to run by
-   * calling the backends' post_run_hook() functions
+   * Clean up in all registered recording and stimulation backends after a
+   * single call to run by calling the backends' post_run_hook() functions
    */
   void post_run_hook();
   void pre_run_hook();
 
   /**
-   * Clean up in all registered recording backends after a single simulation
-   * step by calling the backends' post_step_hook() functions
+   * Clean up in all registered recording and stimulation backends after a
+   * single simulation step by calling the backends' post_step_hook() functions.
+   * Before, the buffering recorders of the calling thread write their records.
    */
   void post_step_hook();
 
   /**
-   * Finalize all registered recording backends after a call to
+   * Finalize all registered recording and stimulation backends after a call to
    * SimulationManager::simulate() or SimulationManager::cleanup() by
    * calling the backends' finalize() functions
    */
@@ -100,6 +103,14 @@ public:
   bool is_valid_recording_backend( Name ) const;
 
   void write( Name, const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& );
+  void write_spikes( Name, const RecordingDevice&, const std::vector< RecordedSpike >& );
+
+  /**
+   * Register a recording device that collects its records during a time
+   * slice. The device writes them in post_step_hook(), called by its thread.
+   * Registrations persist until the kernel is reset.
+   */
+  void register_buffering_recorder( RecordingDevice& );
 
   void enroll_recorder( Name, const RecordingDevice&, const DictionaryDatum& );
 
@@ -111,10 +122,29 @@ public:
   void check_recording_backend_device_status( Name, const DictionaryDatum& );
   void get_recording_backend_device_defaults( Name, DictionaryDatum& );
   void get_recording_backend_device_status( Name, const RecordingDevice&, DictionaryDatum& );
+  void get_recording_backend_device_columns( Name, const RecordingDevice&, const bool, RecordingColumns& );
+
+  bool is_valid_stimulation_backend( Name ) const;
+
+  /**
+   * Enroll the stimulating device with the named backend and disenroll
+   * it from all others. An empty name disenrolls it from all backends.
+   */
+  void enroll_stimulator( Name, DeviceNode&, const Device&, const DictionaryDatum& );
+
+  /**
+   * Check the per-device properties of all stimulation backends. A
+   * stimulating device caches these properties, so that they are available
+   * when the backend of the device is changed.
+   */
+  void check_stimulation_backend_device_status( const DictionaryDatum& );
+  void get_stimulation_backend_device_defaults( DictionaryDatum& );
+  void get_stimulation_backend_device_status( Name, const DeviceNode&, DictionaryDatum& );
 
 private:
   void set_data_path_prefix_( const DictionaryDatum& );
   void register_recording_backends_();
+  void register_stimulation_backends_();
 
   std::string data_path_;   //!< Path for all files written by devices
   std::string data_prefix_; //!< Prefix for all files written by devices
@@ -124,6 +154,14 @@ private:
    * A mapping from names to registered recording backends.
    */
   std::map< Name, RecordingBackend* > recording_backends_;
+
+  /**
+   * A mapping from names to registered stimulation backends.
+   */
+  std::map< Name, StimulationBackend* > stimulation_backends_;
+
+  //! Recording devices that write their records once per time slice, per thread
+  std::vector< std::vector< RecordingDevice* > > buffering_recorders_;
 };
 
 } // namespace nest
@@ -22,6 +22,9 @@
 
 #include "kernel_manager.h"
 
+// Includes from nestkernel:
+#include "memory_status.h"
+
 nest::KernelManager* nest::KernelManager::kernel_manager_instance_ = 0;
 
 void
@@ -174,4 +177,6 @@ nest::KernelManager::get_status( DictionaryDatum& dict )
   {
     manager->get_status( dict );
   }
+
+  def_memory_total( dict );
 }
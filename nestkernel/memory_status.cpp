@@ -0,0 +1,118 @@
+/*
+ *  memory_status.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "memory_status.h"
+
+// C++ includes:
+#include <numeric>
+
+// Includes from nestkernel:
+#include "nest_names.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dictutils.h"
+
+namespace nest
+{
+
+namespace
+{
+
+void
+def_memory_entry( DictionaryDatum& dict,
+  const Name entry,
+  const Name subsystem,
+  const std::vector< long >& per_thread,
+  const long shared,
+  const DictionaryDatum& per_synapse_model )
+{
+  if ( not dict->known( entry ) )
+  {
+    ( *dict )[ entry ] = DictionaryDatum( new Dictionary );
+  }
+  DictionaryDatum memory = getValue< DictionaryDatum >( dict, entry );
+
+  DictionaryDatum status( new Dictionary );
+  def< long >( status, names::total, std::accumulate( per_thread.begin(), per_thread.end(), shared ) );
+  if ( not per_thread.empty() )
+  {
+    def< std::vector< long > >( status, names::per_thread, per_thread );
+  }
+  if ( per_synapse_model.valid() )
+  {
+    ( *status )[ names::per_synapse_model ] = per_synapse_model;
+  }
+
+  ( *memory )[ subsystem ] = status;
+}
+
+void
+def_memory_entry_total( DictionaryDatum& dict, const Name entry )
+{
+  if ( not dict->known( entry ) )
+  {
+    return;
+  }
+  DictionaryDatum memory = getValue< DictionaryDatum >( dict, entry );
+
+  long total = 0;
+  for ( auto& subsystem : *memory )
+  {
+    DictionaryDatum* status = dynamic_cast< DictionaryDatum* >( subsystem.second.datum() );
+    if ( status != nullptr )
+    {
+      total += getValue< long >( *status, names::total );
+    }
+  }
+  def< long >( memory, names::total, total );
+}
+
+} // namespace
+
+void
+def_memory_status( DictionaryDatum& dict,
+  const Name subsystem,
+  const std::vector< long >& per_thread,
+  const long shared,
+  const DictionaryDatum& per_synapse_model )
+{
+  def_memory_entry( dict, names::memory, subsystem, per_thread, shared, per_synapse_model );
+}
+
+void
+def_memory_forecast( DictionaryDatum& dict,
+  const Name subsystem,
+  const std::vector< long >& per_thread,
+  const long shared )
+{
+  def_memory_entry( dict, names::memory_forecast, subsystem, per_thread, shared, DictionaryDatum() );
+}
+
+void
+def_memory_total( DictionaryDatum& dict )
+{
+  def_memory_entry_total( dict, names::memory );
+  def_memory_entry_total( dict, names::memory_forecast );
+}
+
+} // namespace nest
@@ -0,0 +1,123 @@
+/*
+ *  memory_status.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef MEMORY_STATUS_H
+#define MEMORY_STATUS_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from libnestutil:
+#include "block_vector.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "name.h"
+
+/**
+ * Accounting of the memory allocated by the kernel.
+ *
+ * The managers report the memory allocated by their data structures in the
+ * dictionary /memory of the kernel status. Each subsystem is described by
+ * a dictionary with the entries /total, and if applicable /per_thread and
+ * /per_synapse_model. All values are in bytes and computed from the
+ * capacities of the containers, i.e., they include memory reserved but not
+ * yet used, but not the overhead of the allocator.
+ *
+ * In dry-run mode (see SetFakeNumProcesses), the managers in addition
+ * report the memory predicted for the simulation on the faked rank in the
+ * dictionary /memory_forecast, which has the same layout. The forecast
+ * includes the data structures that are only allocated when the
+ * simulation is prepared.
+ */
+
+namespace nest
+{
+
+/**
+ * Bytes allocated for the elements of a vector.
+ */
+template < typename T >
+inline size_t
+allocated_bytes( const std::vector< T >& v )
+{
+  return v.capacity() * sizeof( T );
+}
+
+/**
+ * Bytes allocated for the elements of a nested vector, including the
+ * elements of all inner vectors.
+ */
+template < typename T >
+inline size_t
+allocated_bytes( const std::vector< std::vector< T > >& v )
+{
+  size_t bytes = v.capacity() * sizeof( std::vector< T > );
+  for ( const auto& inner : v )
+  {
+    bytes += allocated_bytes( inner );
+  }
+  return bytes;
+}
+
+/**
+ * Bytes allocated for the elements of a BlockVector.
+ */
+template < typename T >
+inline size_t
+allocated_bytes( const BlockVector< T >& v )
+{
+  return v.capacity() * sizeof( T );
+}
+
+/**
+ * Add the memory status of a subsystem to the dictionary /memory in dict.
+ *
+ * per_thread holds the bytes allocated by each thread and may be empty
+ * for subsystems not organized by thread, shared the bytes not
+ * attributable to a thread. If given, per_synapse_model is added as is.
+ * The total of the subsystem is the sum of per_thread and shared.
+ */
+void def_memory_status( DictionaryDatum& dict,
+  const Name subsystem,
+  const std::vector< long >& per_thread,
+  const long shared = 0,
+  const DictionaryDatum& per_synapse_model = DictionaryDatum() );
+
+/**
+ * Add the memory forecast of a subsystem to the dictionary
+ * /memory_forecast in dict, see def_memory_status().
+ */
+void def_memory_forecast( DictionaryDatum& dict,
+  const Name subsystem,
+  const std::vector< long >& per_thread,
+  const long shared = 0 );
+
+/**
+ * Add the sum of the totals of all subsystems as /total to the
+ * dictionaries /memory and /memory_forecast in dict, if they exist.
+ */
+void def_memory_total( DictionaryDatum& dict );
+
+} // namespace nest
+
+#endif /* MEMORY_STATUS_H */
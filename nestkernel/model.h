@@ -132,6 +132,11 @@ public:
    */
   size_t mem_capacity();
 
+  /**
+   * Return the memory capacity of thread t in number of elements.
+   */
+  size_t mem_capacity( const thread t ) const;
+
   virtual bool has_proxies() = 0;
   virtual bool one_node_per_process() = 0;
   virtual bool is_off_grid() = 0;
@@ -58,6 +58,7 @@ nest::MPIManager::MPIManager()
   : num_processes_( 1 )
   , rank_( 0 )
   , use_mpi_( false )
+  , dryrun_mode_( false )
   , buffer_size_target_data_( 1 )
   , buffer_size_spike_data_( 1 )
   , chunk_size_secondary_events_in_int_( 0 )
@@ -74,6 +75,7 @@ nest::MPIManager::MPIManager()
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , ialltoall_request_( MPI_REQUEST_NULL )
 #endif
 {
 }
@@ -170,6 +172,27 @@ nest::MPIManager::finalize()
 {
 }
 
+void
+nest::MPIManager::enable_dryrun_mode( thread n_procs, thread rank )
+{
+  if ( n_procs < 1 )
+  {
+    throw BadParameter( "The number of processes must be positive." );
+  }
+  if ( rank < 0 or rank >= n_procs )
+  {
+    throw BadParameter( "The rank must be smaller than the number of processes." );
+  }
+  if ( num_processes_ > 1 and not dryrun_mode_ )
+  {
+    throw KernelException( "Dry-run mode cannot be used with more than one MPI process." );
+  }
+
+  num_processes_ = n_procs;
+  rank_ = rank;
+  dryrun_mode_ = true;
+}
+
 void
 nest::MPIManager::set_status( const DictionaryDatum& dict )
 {
@@ -203,6 +226,7 @@ void
 nest::MPIManager::get_status( DictionaryDatum& dict )
 {
   def< long >( dict, names::num_processes, num_processes_ );
+  def< long >( dict, names::rank, rank_ );
   def< bool >( dict, names::adaptive_spike_buffers, adaptive_spike_buffers_ );
   def< bool >( dict, names::adaptive_target_buffers, adaptive_target_buffers_ );
   def< size_t >( dict, names::buffer_size_target_data, buffer_size_target_data_ );
@@ -709,6 +733,26 @@ nest::MPIManager::communicate_Alltoall_( void* send_buffer, void* recv_buffer, c
   MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
 }
 
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count )
+{
+  assert( ialltoall_request_ == MPI_REQUEST_NULL );
+#if MPI_VERSION >= 3
+  MPI_Ialltoall(
+    send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm, &ialltoall_request_ );
+#else
+  // non-blocking collectives require MPI 3; the exchange then completes
+  // immediately and wait_for_Ialltoall() returns without waiting
+  MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
+#endif
+}
+
+void
+nest::MPIManager::wait_for_Ialltoall()
+{
+  // returns immediately if no request is pending
+  MPI_Wait( &ialltoall_request_, MPI_STATUS_IGNORE );
+}
 
 void
 nest::MPIManager::communicate_secondary_events_Alltoall_( void* send_buffer, void* recv_buffer )
@@ -91,10 +91,19 @@ public:
   thread get_num_processes() const;
 
   /**
-   * Set the number of processes state variable.
-   * This is used by dryrun_mode.
+   * Let this process pretend to be process rank of n_procs processes.
+   *
+   * In dry-run mode, the network is constructed as on process rank of a
+   * simulation with n_procs processes, but it cannot be simulated.
+   * @throws BadParameter if rank is not in [0, n_procs).
+   * @throws KernelException if more than one MPI process is used.
+   */
+  void enable_dryrun_mode( thread n_procs, thread rank );
+
+  /**
+   * Return whether dry-run mode is enabled.
    */
-  void set_num_processes( thread n_procs );
+  bool is_dryrun_mode() const;
 
   /**
    * Get rank of MPI process
@@ -198,6 +207,8 @@ public:
 #ifdef HAVE_MPI
   void communicate_Alltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
 
+  void communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
   void communicate_secondary_events_Alltoall_( void* send_buffer, void* recv_buffer );
 #endif // HAVE_MPI
 
@@ -214,6 +225,25 @@ public:
   template < class D >
   void communicate_secondary_events_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
+  /**
+   * Non-blocking variants of the spike data exchange. Only one exchange
+   * may be pending at any time. Neither buffer may be accessed until
+   * wait_for_Ialltoall() has returned.
+   */
+  template < class D >
+  void communicate_Ialltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  /**
+   * Block until the pending non-blocking Alltoall has completed.
+   */
+  void wait_for_Ialltoall();
+
   void synchronize();
 
   bool grng_synchrony( unsigned long );
@@ -267,6 +297,7 @@ private:
   int send_buffer_size_;           //!< expected size of send buffer
   int recv_buffer_size_;           //!< size of receive buffer
   bool use_mpi_;                   //!< whether MPI is used
+  bool dryrun_mode_;               //!< whether the processes are faked
   size_t buffer_size_target_data_; //!< total size of MPI buffer for
   // communication of connections
 
@@ -303,6 +334,9 @@ private:
   MPI_Comm comm;
   MPI_Datatype MPI_OFFGRID_SPIKE;
 
+  //! Request of the pending non-blocking Alltoall, if any
+  MPI_Request ialltoall_request_;
+
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
     std::vector< int >& displacements );
@@ -397,10 +431,10 @@ MPIManager::get_num_processes() const
   return num_processes_;
 }
 
-inline void
-MPIManager::set_num_processes( thread n_procs )
+inline bool
+MPIManager::is_dryrun_mode() const
 {
-  num_processes_ = n_procs;
+  return dryrun_mode_;
 }
 
 inline thread
@@ -590,6 +624,11 @@ MPIManager::synchronize()
 {
 }
 
+inline void
+MPIManager::wait_for_Ialltoall()
+{
+}
+
 inline void
 test_link( int, int )
 {
@@ -671,6 +710,18 @@ MPIManager::communicate_secondary_events_Alltoall( std::vector< D >& send_buffer
   communicate_secondary_events_Alltoall_( send_buffer_int, recv_buffer_int );
 }
 
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Ialltoall_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
 
 #else // HAVE_MPI
 template < class D >
@@ -689,6 +740,15 @@ MPIManager::communicate_secondary_events_Alltoall( std::vector< D >& send_buffer
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif // HAVE_MPI
 
 template < class D >
@@ -720,6 +780,26 @@ MPIManager::communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buf
 
   communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
 }
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
+}
 }
 
 #endif /* MPI_MANAGER_H */
@@ -26,10 +26,12 @@
 #include <cassert>
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
 #include "parameter.h"
+#include "recording_device.h"
 
 // Includes from sli:
 #include "sliexceptions.h"
@@ -63,9 +65,9 @@ reset_kernel()
 }
 
 void
-enable_dryrun_mode( const index n_procs )
+enable_dryrun_mode( const index n_procs, const index rank )
 {
-  kernel().mpi_manager.set_num_processes( n_procs );
+  kernel().mpi_manager.enable_dryrun_mode( n_procs, rank );
 }
 
 void
@@ -201,115 +203,7 @@ connect_arrays( long* sources,
   size_t n,
   std::string syn_model )
 {
-  // Mapping pointers to the first parameter value of each parameter to their respective names.
-  std::map< Name, double* > param_pointers;
-  if ( p_keys.size() != 0 )
-  {
-    size_t i = 0;
-    for ( auto& key : p_keys )
-    {
-      // Shifting the pointer to the first value of the parameter.
-      param_pointers[ key ] = p_values + i * n;
-      ++i;
-    }
-  }
-
-  // Dictionary holding additional synapse parameters, passed to the connect call.
-  std::vector< DictionaryDatum > param_dicts( kernel().vp_manager.get_num_threads(), new Dictionary() );
-  index synapse_model_id( kernel().model_manager.get_synapsedict()->lookup( syn_model ) );
-
-  // Increments pointers to weight, delay, and receptor type, if they are specified.
-  auto increment_wd = [weights, delays]( decltype( weights ) w, decltype( delays ) d )
-  {
-    if ( weights != nullptr )
-    {
-      ++w;
-    }
-    if ( delays != nullptr )
-    {
-      ++d;
-    }
-  };
-  // Vector for storing exceptions raised by threads.
-  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
-#pragma omp parallel
-  {
-    const auto tid = kernel().vp_manager.get_thread_id();
-    try
-    {
-      auto s = sources;
-      auto t = targets;
-      auto w = weights;
-      auto d = delays;
-      double weight_buffer = numerics::nan;
-      double delay_buffer = numerics::nan;
-      for ( ; s != sources + n; ++s, ++t )
-      {
-        if ( 0 >= *s or static_cast< index >( *s ) > kernel().node_manager.size() )
-        {
-          throw UnknownNode( *s );
-        }
-        if ( 0 >= *t or static_cast< index >( *t ) > kernel().node_manager.size() )
-        {
-          throw UnknownNode( *t );
-        }
-        auto target_node = kernel().node_manager.get_node_or_proxy( *t, tid );
-        if ( target_node->is_proxy() )
-        {
-          increment_wd( w, d );
-          continue;
-        }
-        // If weights or delays are specified, the buffers are replaced with the values.
-        // If not, the buffers will be NaN and replaced by a default value by the connect function.
-        if ( weights != nullptr )
-        {
-          weight_buffer = *w;
-        }
-        if ( delays != nullptr )
-        {
-          delay_buffer = *d;
-        }
-
-        // Store the key-value pair of each parameter in the Dictionary.
-        for ( auto& param_pointer_pair : param_pointers )
-        {
-          // Receptor type must be an integer.
-          if ( param_pointer_pair.first == names::receptor_type )
-          {
-            const auto int_cast_rtype = static_cast< size_t >( *param_pointer_pair.second );
-            if ( int_cast_rtype != *param_pointer_pair.second )
-            {
-              throw BadParameter( "Receptor types must be integers." );
-            }
-            ( *param_dicts[ tid ] )[ param_pointer_pair.first ] = int_cast_rtype;
-          }
-          else
-          {
-            ( *param_dicts[ tid ] )[ param_pointer_pair.first ] = *param_pointer_pair.second;
-          }
-          // Increment the pointer to the parameter value.
-          ++param_pointer_pair.second;
-        }
-
-        kernel().connection_manager.connect(
-          *s, target_node, tid, synapse_model_id, param_dicts[ tid ], delay_buffer, weight_buffer );
-        increment_wd( w, d );
-      }
-    }
-    catch ( std::exception& err )
-    {
-      // We must create a new exception here, err's lifetime ends at the end of the catch block.
-      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
-    }
-  }
-  // check if any exceptions have been raised
-  for ( thread tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
-  {
-    if ( exceptions_raised.at( tid ).get() )
-    {
-      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
-    }
-  }
+  kernel().connection_manager.connect_arrays( sources, targets, weights, delays, p_keys, p_values, n, syn_model );
 }
 
 ArrayDatum
@@ -324,6 +218,32 @@ get_connections( const DictionaryDatum& dict )
   return array;
 }
 
+void
+get_connection_columns( const DictionaryDatum& dict, ConnectionColumns& columns )
+{
+  dict->clear_access_flags();
+
+  kernel().connection_manager.get_connection_columns( dict, columns );
+
+  ALL_ENTRIES_ACCESSED( *dict, "GetConnectionArrays", "Unread dictionary entries: " );
+}
+
+void
+get_recording_columns( const index node_id, const bool drain, RecordingColumns& columns )
+{
+  // recording devices have one instance per thread, which stores the events
+  // recorded on this thread
+  for ( Node* node : kernel().node_manager.get_thread_siblings( node_id ) )
+  {
+    const RecordingDevice* device = dynamic_cast< const RecordingDevice* >( node );
+    if ( device == NULL )
+    {
+      throw BadParameter( "Only recording devices store events." );
+    }
+    device->get_columns( drain, columns );
+  }
+}
+
 void
 simulate( const double& t )
 {
@@ -367,6 +287,18 @@ cleanup()
   kernel().cleanup();
 }
 
+void
+checkpoint( const std::string& name )
+{
+  write_checkpoint( name );
+}
+
+void
+restore( const std::string& name )
+{
+  read_checkpoint( name );
+}
+
 void
 copy_model( const Name& oldmodname, const Name& newmodname, const DictionaryDatum& dict )
 {
@@ -34,6 +34,8 @@
 #include "randomgen.h"
 
 // Includes from nestkernel:
+#include "connection_columns.h"
+#include "recording_columns.h"
 #include "nest_datums.h"
 #include "nest_time.h"
 #include "nest_types.h"
@@ -52,7 +54,7 @@ void install_module( const std::string& module_name );
 
 void reset_kernel();
 
-void enable_dryrun_mode( const index n_procs );
+void enable_dryrun_mode( const index n_procs, const index rank = 0 );
 
 void register_logger_client( const deliver_logging_event_ptr client_callback );
 
@@ -145,6 +147,23 @@ void connect_arrays( long* sources,
 
 ArrayDatum get_connections( const DictionaryDatum& dict );
 
+/**
+ * Write the connections selected by dict to columns.
+ *
+ * dict accepts the same entries as for get_connections(). This function is
+ * used by PyNEST to expose the columns as NumPy arrays without copying.
+ */
+void get_connection_columns( const DictionaryDatum& dict, ConnectionColumns& columns );
+
+/**
+ * Write the events stored for the recording device node_id to columns.
+ *
+ * The events of all thread-local instances of the device are collected. If
+ * drain is true, they are removed from the recording backend. This function
+ * is used by PyNEST to expose the columns as NumPy arrays without copying.
+ */
+void get_recording_columns( const index node_id, const bool drain, RecordingColumns& columns );
+
 void simulate( const double& t );
 
 /**
@@ -189,6 +208,26 @@ void prepare();
  */
 void cleanup();
 
+/**
+ * @fn checkpoint()
+ * @brief write the state of the network to checkpoint files
+ *
+ * Each MPI process writes its part of the network to its own file.
+ *
+ * @see restore()
+ */
+void checkpoint( const std::string& name );
+
+/**
+ * @fn restore()
+ * @brief re-create the network from checkpoint files
+ *
+ * The kernel must not contain any nodes.
+ *
+ * @see checkpoint()
+ */
+void restore( const std::string& name );
+
 void copy_model( const Name& oldmodname, const Name& newmodname, const DictionaryDatum& dict );
 
 void set_model_defaults( const Name& model_name, const DictionaryDatum& );
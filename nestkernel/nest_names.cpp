@@ -45,6 +45,7 @@ const Name adapting_threshold( "adapting_threshold" );
 const Name adaptive_spike_buffers( "adaptive_spike_buffers" );
 const Name adaptive_target_buffers( "adaptive_target_buffers" );
 const Name after_spike_currents( "after_spike_currents" );
+const Name aggregate( "aggregate" );
 const Name ahp_bug( "ahp_bug" );
 const Name allow_autapses( "allow_autapses" );
 const Name allow_multapses( "allow_multapses" );
@@ -67,11 +68,13 @@ const Name asc_init( "asc_init" );
 const Name asc_r( "asc_r" );
 const Name ASCurrents( "ASCurrents" );
 const Name ASCurrents_sum( "ASCurrents_sum" );
+const Name asynchronous( "asynchronous" );
 const Name available( "available" );
 
 const Name b( "b" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
+const Name binned( "binned" );
 const Name buffer_size( "buffer_size" );
 const Name buffer_size_secondary_events( "buffer_size_secondary_events" );
 const Name buffer_size_spike_data( "buffer_size_spike_data" );
@@ -86,11 +89,16 @@ const Name Ca( "Ca" );
 const Name calibrate( "calibrate" );
 const Name calibrate_node( "calibrate_node" );
 const Name capacity( "capacity" );
+const Name channel( "channel" );
+const Name chunk_size( "chunk_size" );
 const Name clear( "clear" );
 const Name comparator( "comparator" );
+const Name compressed( "compressed" );
+const Name compression_level( "compression_level" );
 const Name configbit_0( "configbit_0" );
 const Name configbit_1( "configbit_1" );
 const Name connection_count( "connection_count" );
+const Name connections( "connections" );
 const Name consistent_integration( "consistent_integration" );
 const Name continuous( "continuous" );
 const Name count_covariance( "count_covariance" );
@@ -159,6 +167,7 @@ const Name error( "error" );
 const Name eta( "eta" );
 const Name events( "events" );
 const Name ex_spikes( "ex_spikes" );
+const Name expected_rate( "expected_rate" );
 
 const Name file_extension( "file_extension" );
 const Name filename( "filename" );
@@ -262,8 +271,10 @@ const Name max_buffer_size_spike_data( "max_buffer_size_spike_data" );
 const Name max_buffer_size_target_data( "max_buffer_size_target_data" );
 const Name max_num_syn_models( "max_num_syn_models" );
 const Name max_delay( "max_delay" );
+const Name max_values( "max_values" );
 const Name mean( "mean" );
 const Name memory( "memory" );
+const Name memory_forecast( "memory_forecast" );
 const Name message_times( "messages_times" );
 const Name messages( "messages" );
 const Name min( "min" );
@@ -271,6 +282,7 @@ const Name min_delay( "min_delay" );
 const Name model( "model" );
 const Name mother_rng( "mother_rng" );
 const Name mother_seed( "mother_seed" );
+const Name mpi_buffers( "mpi_buffers" );
 const Name ms_per_tic( "ms_per_tic" );
 const Name mu( "mu" );
 const Name mu_minus( "mu_minus" );
@@ -291,7 +303,9 @@ const Name neuron( "neuron" );
 const Name next_readout_time( "next_readout_time" );
 const Name NMDA( "NMDA" );
 const Name no_synapses( "no_synapses" );
+const Name node_buffers( "node_buffers" );
 const Name node_uses_wfr( "node_uses_wfr" );
+const Name nodes( "nodes" );
 const Name noise( "noise" );
 const Name noisy_rate( "noisy_rate" );
 const Name num_connections( "num_connections" );
@@ -311,8 +325,12 @@ const Name p( "p" );
 const Name P( "P" );
 const Name p_copy( "p_copy" );
 const Name p_transmit( "p_transmit" );
+const Name per_synapse_model( "per_synapse_model" );
+const Name per_thread( "per_thread" );
 const Name phase( "phase" );
 const Name phi_max( "phi_max" );
+const Name pipelined_spike_exchange( "pipelined_spike_exchange" );
+const Name population_update( "population_update" );
 const Name port( "port" );
 const Name port_name( "port_name" );
 const Name port_width( "port_width" );
@@ -334,6 +352,7 @@ const Name q_rr( "q_rr" );
 const Name q_sfa( "q_sfa" );
 const Name q_stc( "q_stc" );
 
+const Name rank( "rank" );
 const Name rate( "rate" );
 const Name rate_slope( "rate_slope" );
 const Name rate_times( "rate_times" );
@@ -342,6 +361,7 @@ const Name readout_cycle_duration( "readout_cycle_duration" );
 const Name receptor_type( "receptor_type" );
 const Name receptor_types( "receptor_types" );
 const Name receptors( "receptors" );
+const Name record_fraction( "record_fraction" );
 const Name record_from( "record_from" );
 const Name record_to( "record_to" );
 const Name recordables( "recordables" );
@@ -363,8 +383,11 @@ const Name rule( "rule" );
 
 const Name S( "S" );
 const Name S_act_NMDA( "S_act_NMDA" );
+const Name sample_size( "sample_size" );
+const Name sampled_targets( "sampled_targets" );
 const Name scale( "scale" );
 const Name sdev( "sdev" );
+const Name segment_name( "segment_name" );
 const Name senders( "senders" );
 const Name shift_now_spikes( "shift_now_spikes" );
 const Name sigma( "sigma" );
@@ -373,21 +396,26 @@ const Name sion_chunksize( "sion_chunksize" );
 const Name sion_collective( "sion_collective" );
 const Name sion_n_files( "sion_n_files" );
 const Name size_of( "sizeof" );
+const Name snapshot_interval( "snapshot_interval" );
 const Name soma_curr( "soma_curr" );
 const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
 const Name sort_connections_by_source( "sort_connections_by_source" );
 const Name source( "source" );
+const Name source_table( "source_table" );
 const Name spike( "spike" );
 const Name spike_dependent_threshold( "spike_dependent_threshold" );
 const Name spike_multiplicities( "spike_multiplicities" );
+const Name spike_register( "spike_register" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
 const Name start( "start" );
 const Name state( "state" );
 const Name std( "std" );
 const Name std_mod( "std_mod" );
+const Name stimulation_backends( "stimulation_backends" );
 const Name stimulator( "stimulator" );
+const Name stimulus_source( "stimulus_source" );
 const Name stop( "stop" );
 const Name structural_plasticity_synapses( "structural_plasticity_synapses" );
 const Name structural_plasticity_update_interval( "structural_plasticity_update_interval" );
@@ -411,6 +439,8 @@ const Name t_ref_remaining( "t_ref_remaining" );
 const Name t_ref_tot( "t_ref_tot" );
 const Name t_spike( "t_spike" );
 const Name target( "target" );
+const Name target_table( "target_table" );
+const Name target_table_devices( "target_table_devices" );
 const Name target_thread( "target_thread" );
 const Name targets( "targets" );
 const Name tau( "tau" );
@@ -486,10 +516,20 @@ const Name tics_per_ms( "tics_per_ms" );
 const Name tics_per_step( "tics_per_step" );
 const Name time( "time" );
 const Name time_collocate( "time_collocate" );
+const Name time_collocate_spike_data( "time_collocate_spike_data" );
 const Name time_communicate( "time_communicate" );
+const Name time_communicate_spike_data( "time_communicate_spike_data" );
+const Name time_deliver_secondary_events( "time_deliver_secondary_events" );
+const Name time_deliver_spike_data( "time_deliver_spike_data" );
+const Name time_gather_secondary_events( "time_gather_secondary_events" );
 const Name time_in_steps( "time_in_steps" );
+const Name time_omp_synchronization( "time_omp_synchronization" );
+const Name time_post_step_hook( "time_post_step_hook" );
+const Name time_update( "time_update" );
+const Name time_wfr_update( "time_wfr_update" );
 const Name times( "times" );
 const Name to_do( "to_do" );
+const Name total( "total" );
 const Name total_num_virtual_procs( "total_num_virtual_procs" );
 const Name Tstart( "Tstart" );
 const Name Tstop( "Tstop" );
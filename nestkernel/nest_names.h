@@ -66,6 +66,7 @@ extern const Name adapting_threshold;
 extern const Name adaptive_spike_buffers;
 extern const Name adaptive_target_buffers;
 extern const Name after_spike_currents;
+extern const Name aggregate;
 extern const Name ahp_bug;
 extern const Name allow_autapses;
 extern const Name allow_multapses;
@@ -88,11 +89,13 @@ extern const Name asc_init;
 extern const Name asc_r;
 extern const Name ASCurrents;
 extern const Name ASCurrents_sum;
+extern const Name asynchronous;
 extern const Name available;
 
 extern const Name b;
 extern const Name beta;
 extern const Name beta_Ca;
+extern const Name binned;
 extern const Name buffer_size;
 extern const Name buffer_size_secondary_events;
 extern const Name buffer_size_spike_data;
@@ -107,11 +110,16 @@ extern const Name Ca;
 extern const Name calibrate;
 extern const Name calibrate_node;
 extern const Name capacity;
+extern const Name channel;
+extern const Name chunk_size;
 extern const Name clear;
 extern const Name comparator;
+extern const Name compressed;
+extern const Name compression_level;
 extern const Name configbit_0;
 extern const Name configbit_1;
 extern const Name connection_count;
+extern const Name connections;
 extern const Name consistent_integration;
 extern const Name continuous;
 extern const Name count_covariance;
@@ -180,6 +188,7 @@ extern const Name error;
 extern const Name eta;
 extern const Name events;
 extern const Name ex_spikes;
+extern const Name expected_rate;
 
 extern const Name file_extension;
 extern const Name filename;
@@ -283,8 +292,10 @@ extern const Name max_buffer_size_spike_data;
 extern const Name max_buffer_size_target_data;
 extern const Name max_num_syn_models;
 extern const Name max_delay;
+extern const Name max_values;
 extern const Name mean;
 extern const Name memory;
+extern const Name memory_forecast;
 extern const Name message_times;
 extern const Name messages;
 extern const Name min;
@@ -292,6 +303,7 @@ extern const Name min_delay;
 extern const Name model;
 extern const Name mother_rng;
 extern const Name mother_seed;
+extern const Name mpi_buffers;
 extern const Name ms_per_tic;
 extern const Name mu;
 extern const Name mu_minus;
@@ -312,7 +324,9 @@ extern const Name neuron;
 extern const Name next_readout_time;
 extern const Name NMDA;
 extern const Name no_synapses;
+extern const Name node_buffers;
 extern const Name node_uses_wfr;
+extern const Name nodes;
 extern const Name noise;
 extern const Name noisy_rate;
 extern const Name num_connections;
@@ -332,8 +346,12 @@ extern const Name p;
 extern const Name P;
 extern const Name p_copy;
 extern const Name p_transmit;
+extern const Name per_synapse_model;
+extern const Name per_thread;
 extern const Name phase;
 extern const Name phi_max;
+extern const Name pipelined_spike_exchange;
+extern const Name population_update;
 extern const Name port;
 extern const Name port_name;
 extern const Name port_width;
@@ -355,6 +373,7 @@ extern const Name q_rr;
 extern const Name q_sfa;
 extern const Name q_stc;
 
+extern const Name rank;
 extern const Name rate;
 extern const Name rate_slope;
 extern const Name rate_times;
@@ -363,6 +382,7 @@ extern const Name readout_cycle_duration;
 extern const Name receptor_type;
 extern const Name receptor_types;
 extern const Name receptors;
+extern const Name record_fraction;
 extern const Name record_from;
 extern const Name record_to;
 extern const Name recordables;
@@ -384,8 +404,11 @@ extern const Name rule;
 
 extern const Name S;
 extern const Name S_act_NMDA;
+extern const Name sample_size;
+extern const Name sampled_targets;
 extern const Name scale;
 extern const Name sdev;
+extern const Name segment_name;
 extern const Name senders;
 extern const Name shift_now_spikes;
 extern const Name sigma;
@@ -394,21 +417,26 @@ extern const Name sion_chunksize;
 extern const Name sion_collective;
 extern const Name sion_n_files;
 extern const Name size_of;
+extern const Name snapshot_interval;
 extern const Name soma_curr;
 extern const Name soma_exc;
 extern const Name soma_inh;
 extern const Name sort_connections_by_source;
 extern const Name source;
+extern const Name source_table;
 extern const Name spike;
 extern const Name spike_dependent_threshold;
 extern const Name spike_multiplicities;
+extern const Name spike_register;
 extern const Name spike_times;
 extern const Name spike_weights;
 extern const Name start;
 extern const Name state;
 extern const Name std;
 extern const Name std_mod;
+extern const Name stimulation_backends;
 extern const Name stimulator;
+extern const Name stimulus_source;
 extern const Name stop;
 extern const Name structural_plasticity_synapses;
 extern const Name structural_plasticity_update_interval;
@@ -432,6 +460,8 @@ extern const Name t_ref_remaining;
 extern const Name t_ref_tot;
 extern const Name t_spike;
 extern const Name target;
+extern const Name target_table;
+extern const Name target_table_devices;
 extern const Name target_thread;
 extern const Name targets;
 extern const Name tau;
@@ -507,10 +537,20 @@ extern const Name tics_per_ms;
 extern const Name tics_per_step;
 extern const Name time;
 extern const Name time_collocate;
+extern const Name time_collocate_spike_data;
 extern const Name time_communicate;
+extern const Name time_communicate_spike_data;
+extern const Name time_deliver_secondary_events;
+extern const Name time_deliver_spike_data;
+extern const Name time_gather_secondary_events;
 extern const Name time_in_steps;
+extern const Name time_omp_synchronization;
+extern const Name time_post_step_hook;
+extern const Name time_update;
+extern const Name time_wfr_update;
 extern const Name times;
 extern const Name to_do;
+extern const Name total;
 extern const Name total_num_virtual_procs;
 extern const Name Tstart;
 extern const Name Tstop;
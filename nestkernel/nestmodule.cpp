@@ -512,6 +512,139 @@ NestModule::GetConnections_DFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: GetConnectionArrays - Retrieve connections as arrays of properties
+
+   Synopsis:
+   dict GetConnectionArrays -> dict
+
+   Description:
+   GetConnectionArrays accepts the same selection dictionary as
+   GetConnections (source, target, synapse_model, synapse_label), but
+   returns the connections column-wise: the result is a dictionary with
+   the integer vectors /source, /target, /target_thread, /synapse_modelid
+   and /port and the double vectors /weight and /delay. Entry i of all
+   vectors describes the same connection. Retrieving large numbers of
+   connections this way is much faster than with GetConnections, as no
+   connection handle is created per connection.
+
+   Connections are ordered by target thread; within each thread,
+   connections between neurons precede connections from or to devices.
+
+   Examples:
+   << /source n /synapse_model /static_synapse >> GetConnectionArrays
+   /weight get
+
+   SeeAlso: GetConnections
+*/
+void
+NestModule::GetConnectionArrays_DFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  DictionaryDatum dict = getValue< DictionaryDatum >( i->OStack.pick( 0 ) );
+
+  ConnectionColumns columns;
+  columns.with_weights_and_delays = true;
+  get_connection_columns( dict, columns );
+
+  // The columns are swapped into the result to avoid copying them.
+  DictionaryDatum result( new Dictionary );
+  const std::pair< Name, std::vector< long >* > int_columns[] = { { names::source, &columns.sources },
+    { names::target, &columns.targets },
+    { names::target_thread, &columns.target_threads },
+    { names::synapse_modelid, &columns.synapse_ids },
+    { names::port, &columns.ports } };
+  for ( auto& column : int_columns )
+  {
+    IntVectorDatum values( new std::vector< long >() );
+    values->swap( *column.second );
+    ( *result )[ column.first ] = values;
+  }
+  DoubleVectorDatum weights( new std::vector< double >() );
+  weights->swap( columns.weights );
+  ( *result )[ names::weight ] = weights;
+  DoubleVectorDatum delays( new std::vector< double >() );
+  delays->swap( columns.delays );
+  ( *result )[ names::delay ] = delays;
+
+  i->OStack.pop();
+  i->OStack.push( result );
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: GetRecordingArrays - Retrieve the events stored by a recorder as arrays
+
+   Synopsis:
+   recorder drain GetRecordingArrays -> dict
+
+   Description:
+   GetRecordingArrays returns the events stored by the memory recording
+   backend for the given recording device in a dictionary with the same
+   entries as the /events dictionary in the status of the device. If
+   drain is true, the events are removed from the backend afterwards,
+   which avoids copying them. Draining the events between calls to Run
+   keeps the memory used for recording constant.
+
+   Examples:
+   sd true GetRecordingArrays /times get
+
+   SeeAlso: GetStatus
+*/
+void
+NestModule::GetRecordingArrays_g_bFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  NodeCollectionDatum recorder = getValue< NodeCollectionDatum >( i->OStack.pick( 1 ) );
+  const bool drain = getValue< bool >( i->OStack.pick( 0 ) );
+  if ( recorder->size() != 1 )
+  {
+    throw BadParameter( "GetRecordingArrays requires a single recording device." );
+  }
+
+  RecordingColumns columns;
+  get_recording_columns( ( *recorder )[ 0 ], drain, columns );
+
+  // The columns are swapped into the result to avoid copying them.
+  DictionaryDatum result( new Dictionary );
+  IntVectorDatum senders( new std::vector< long >() );
+  senders->swap( columns.senders );
+  ( *result )[ names::senders ] = senders;
+  if ( columns.time_in_steps )
+  {
+    IntVectorDatum times( new std::vector< long >() );
+    times->swap( columns.time_steps );
+    ( *result )[ names::times ] = times;
+    DoubleVectorDatum offsets( new std::vector< double >() );
+    offsets->swap( columns.offsets );
+    ( *result )[ names::offsets ] = offsets;
+  }
+  else
+  {
+    DoubleVectorDatum times( new std::vector< double >() );
+    times->swap( columns.times );
+    ( *result )[ names::times ] = times;
+  }
+  for ( size_t j = 0; j < columns.double_values.size(); ++j )
+  {
+    DoubleVectorDatum values( new std::vector< double >() );
+    values->swap( columns.double_values[ j ] );
+    ( *result )[ Name( columns.double_value_names[ j ] ) ] = values;
+  }
+  for ( size_t j = 0; j < columns.long_values.size(); ++j )
+  {
+    IntVectorDatum values( new std::vector< long >() );
+    values->swap( columns.long_values[ j ] );
+    ( *result )[ Name( columns.long_value_names[ j ] ) ] = values;
+  }
+
+  i->OStack.pop( 2 );
+  i->OStack.push( result );
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: Simulate - simulate n milliseconds
 
@@ -613,6 +746,69 @@ NestModule::CleanupFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: Checkpoint - write the state of the network to checkpoint files
+
+   Synopsis:
+   (name) Checkpoint -> -
+
+   Description:
+   Writes all nodes with their state, all connections, the state of the
+   random number generators and the simulation time to binary checkpoint
+   files. Each MPI process writes its own file named
+   <data_path>/<data_prefix><name>-<rank>.ckpt.
+
+   The state of a node comprises its status dictionary. Models which
+   support checkpoints in addition store their internal state and the
+   contents of their input buffers, so that a restored simulation continues
+   exactly like the original one. Currently, this is the case for
+   iaf_psc_alpha, iaf_psc_exp and iaf_psc_delta. Data recorded by devices
+   is not part of a checkpoint.
+
+   Checkpoint cannot be used between Prepare and Cleanup and requires the
+   kernel property keep_source_table to be true.
+
+   SeeAlso: Restore, Simulate
+*/
+void
+NestModule::Checkpoint_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string name = getValue< std::string >( i->OStack.pick( 0 ) );
+  checkpoint( name );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: Restore - re-create the network from checkpoint files
+
+   Synopsis:
+   (name) Restore -> -
+
+   Description:
+   Re-creates the network written by Checkpoint. The kernel must not contain
+   any nodes and must have the same number of MPI processes, threads per
+   process and the same resolution as the kernel that wrote the checkpoint.
+   Models created by CopyModel and changed model defaults must be set up
+   again before calling Restore.
+
+   SeeAlso: Checkpoint, ResetKernel
+*/
+void
+NestModule::Restore_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string name = getValue< std::string >( i->OStack.pick( 0 ) );
+  restore( name );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: CopyModel - copy a model to a new name, set parameters for copy, if
    given
@@ -872,9 +1068,14 @@ NestModule::NumProcessesFunction::execute( SLIInterpreter* i ) const
 /** @BeginDocumentation
    Name: SetFakeNumProcesses - Set a fake number of MPI processes.
    Synopsis: n_procs SetFakeNumProcesses -> -
+             << /num_processes n_procs /rank rank >> SetFakeNumProcesses -> -
    Description:
-   Sets the number of MPI processes to n_procs. Used for benchmarking purposes
-   of memory consumption only.
+   Sets the number of MPI processes to n_procs and the rank of this process
+   to rank (default 0). Used for benchmarking purposes of memory consumption
+   only: the network is constructed as on the given rank of a simulation with
+   n_procs processes, and the kernel status contains the dictionary
+   /memory_forecast with the memory predicted for this rank, including the
+   data structures that are only allocated when the simulation is prepared.
    Please note:
    - Simulation of the network will not be possible after setting fake
      processes.
@@ -902,6 +1103,12 @@ NestModule::NumProcessesFunction::execute( SLIInterpreter* i ) const
              %%% Measure memory consumption
              memory_thisjob ==
 
+             %%% Predict memory consumption of rank 3 in bytes
+             << /num_processes 100 /rank 3 >> SetFakeNumProcesses
+             ResetKernel
+             ...
+             GetKernelStatus /memory_forecast get /total get ==
+
        Execute this script with
              mpirun -np 1 nest example.sli
 
@@ -922,6 +1129,22 @@ NestModule::SetFakeNumProcesses_iFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+void
+NestModule::SetFakeNumProcesses_DFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+  DictionaryDatum dict = getValue< DictionaryDatum >( i->OStack.pick( 0 ) );
+
+  long n_procs = getValue< long >( dict, names::num_processes );
+  long rank = 0;
+  updateValue< long >( dict, names::rank, rank );
+
+  enable_dryrun_mode( n_procs, rank );
+
+  i->OStack.pop( 1 );
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: SyncProcesses - Synchronize all MPI processes.
    Synopsis: SyncProcesses -> -
@@ -1936,12 +2159,16 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "GetKernelStatus", &getkernelstatus_function );
 
   i->createcommand( "GetConnections_D", &getconnections_Dfunction );
+  i->createcommand( "GetConnectionArrays", &getconnectionarrays_Dfunction );
+  i->createcommand( "GetRecordingArrays", &getrecordingarrays_g_bfunction );
   i->createcommand( "cva_C", &cva_cfunction );
 
   i->createcommand( "Simulate_d", &simulatefunction );
   i->createcommand( "Run_d", &runfunction );
   i->createcommand( "Prepare", &preparefunction );
   i->createcommand( "Cleanup", &cleanupfunction );
+  i->createcommand( "Checkpoint", &checkpoint_sfunction );
+  i->createcommand( "Restore", &restore_sfunction );
 
   i->createcommand( "CopyModel_l_l_D", &copymodel_l_l_Dfunction );
   i->createcommand( "SetDefaults_l_D", &setdefaults_l_Dfunction );
@@ -1989,7 +2216,8 @@ NestModule::init( SLIInterpreter* i )
 
   i->createcommand( "Rank", &rankfunction );
   i->createcommand( "NumProcesses", &numprocessesfunction );
-  i->createcommand( "SetFakeNumProcesses", &setfakenumprocesses_ifunction );
+  i->createcommand( "SetFakeNumProcesses_i", &setfakenumprocesses_ifunction );
+  i->createcommand( "SetFakeNumProcesses_D", &setfakenumprocesses_dfunction );
   i->createcommand( "SyncProcesses", &syncprocessesfunction );
   i->createcommand( "TimeCommunication_i_i_b", &timecommunication_i_i_bfunction );
   i->createcommand( "TimeCommunicationv_i_i", &timecommunicationv_i_ifunction );
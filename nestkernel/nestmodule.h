@@ -238,6 +238,18 @@ public:
     void execute( SLIInterpreter* ) const;
   } getconnections_Dfunction;
 
+  class GetConnectionArrays_DFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getconnectionarrays_Dfunction;
+
+  class GetRecordingArrays_g_bFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } getrecordingarrays_g_bfunction;
+
   class SimulateFunction : public SLIFunction
   {
   public:
@@ -262,6 +274,18 @@ public:
     void execute( SLIInterpreter* ) const;
   } cleanupfunction;
 
+  class Checkpoint_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } checkpoint_sfunction;
+
+  class Restore_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const;
+  } restore_sfunction;
+
   class Create_l_iFunction : public SLIFunction
   {
   public:
@@ -322,6 +346,11 @@ public:
     void execute( SLIInterpreter* ) const;
   } setfakenumprocesses_ifunction;
 
+  class SetFakeNumProcesses_DFunction : public SLIFunction
+  {
+    void execute( SLIInterpreter* ) const;
+  } setfakenumprocesses_dfunction;
+
   class SyncProcessesFunction : public SLIFunction
   {
     void execute( SLIInterpreter* ) const;
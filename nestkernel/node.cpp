@@ -48,6 +48,7 @@ Node::Node()
   , frozen_( false )
   , buffers_initialized_( false )
   , node_uses_wfr_( false )
+  , in_population_( false )
 {
 }
 
@@ -62,6 +63,7 @@ Node::Node( const Node& n )
   // copy must always initialized its own buffers
   , buffers_initialized_( false )
   , node_uses_wfr_( n.node_uses_wfr_ )
+  , in_population_( false )
 {
 }
 
@@ -205,6 +207,34 @@ Node::wfr_update( Time const&, const long, const long )
   throw UnexpectedEvent( "Waveform relaxation not supported." );
 }
 
+PopulationEngine*
+Node::create_population_engine() const
+{
+  return 0;
+}
+
+void
+Node::write_checkpoint( std::ostream& ) const
+{
+}
+
+void
+Node::read_checkpoint( std::istream& )
+{
+}
+
+size_t
+Node::get_buffer_memory() const
+{
+  return 0;
+}
+
+size_t
+Node::get_buffer_memory_forecast() const
+{
+  return get_buffer_memory();
+}
+
 /**
  * Default implementation of check_connection just throws IllegalConnection
  */
@@ -52,6 +52,7 @@ namespace nest
 {
 class Model;
 class Archiving_Node;
+class PopulationEngine;
 class TimeConverter;
 
 
@@ -338,6 +339,57 @@ public:
    */
   virtual bool wfr_update( Time const&, const long, const long );
 
+  /**
+   * Create an engine that updates all thread-local nodes of this model
+   * together instead of calling update() on each of them.
+   *
+   * Models that provide a PopulationEngine override this function and
+   * return a new engine, which is owned by the caller. The default
+   * implementation returns 0, i.e., nodes are updated individually.
+   *
+   * @see PopulationEngine
+   */
+  virtual PopulationEngine* create_population_engine() const;
+
+  /**
+   * Returns true if the node is currently updated by a PopulationEngine.
+   */
+  bool is_in_population() const;
+
+  /**
+   * Write the dynamic state of the node that cannot be restored through
+   * set_status(), e.g., refractory counters and the contents of ring
+   * buffers, to a checkpoint.
+   *
+   * When a checkpoint is restored, the NodeManager first sets the status of
+   * the node and initializes its buffers, and then calls read_checkpoint().
+   * The default implementations write and read nothing, i.e., input that
+   * has not yet arrived at the time of the checkpoint is lost.
+   *
+   * @see read_checkpoint()
+   */
+  virtual void write_checkpoint( std::ostream& ) const;
+
+  /**
+   * Restore the state written by write_checkpoint().
+   */
+  virtual void read_checkpoint( std::istream& );
+
+  /**
+   * Return the number of bytes allocated by the buffers of the node, e.g.,
+   * ring buffers and spike history, for the memory status of the kernel.
+   * The node object itself is accounted for by its model. The default
+   * implementation returns 0.
+   */
+  virtual size_t get_buffer_memory() const;
+
+  /**
+   * Return the number of bytes the buffers of the node will allocate when
+   * the simulation is prepared, for the memory forecast in dry-run mode.
+   * The default implementation returns get_buffer_memory().
+   */
+  virtual size_t get_buffer_memory_forecast() const;
+
   /**
    * @defgroup status_interface Configuration interface.
    * Functions and infrastructure, responsible for the configuration
@@ -937,6 +989,7 @@ private:
   bool frozen_;              //!< node shall not be updated if true
   bool buffers_initialized_; //!< Buffers have been initialized
   bool node_uses_wfr_;       //!< node uses waveform relaxation method
+  bool in_population_;       //!< node is updated by a PopulationEngine
   bool initialized_;         //!< set true once a node is fully initialized
 
   NodeCollectionPTR nc_ptr_;
@@ -954,6 +1007,12 @@ Node::node_uses_wfr() const
   return node_uses_wfr_;
 }
 
+inline bool
+Node::is_in_population() const
+{
+  return in_population_;
+}
+
 inline bool
 Node::supports_urbanczik_archiving() const
 {
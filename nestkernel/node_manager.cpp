@@ -23,6 +23,7 @@
 #include "node_manager.h"
 
 // C++ includes:
+#include <map>
 #include <set>
 
 // Includes from libnestutil:
@@ -30,9 +31,11 @@
 #include "logging.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "event_delivery_manager.h"
 #include "genericmodel.h"
 #include "kernel_manager.h"
+#include "memory_status.h"
 #include "model.h"
 #include "model_manager_impl.h"
 #include "node.h"
@@ -50,6 +53,7 @@ NodeManager::NodeManager()
   , wfr_nodes_vec_()
   , wfr_is_used_( false )
   , wfr_network_size_( 0 ) // zero to force update
+  , population_engines_()
   , num_active_nodes_( 0 )
   , num_thread_local_devices_()
   , have_nodes_changed_( true )
@@ -69,6 +73,7 @@ NodeManager::initialize()
   // explicitly force construction of wfr_nodes_vec_ to ensure consistent state
   wfr_network_size_ = 0;
   local_nodes_.resize( kernel().vp_manager.get_num_threads() );
+  population_engines_.resize( kernel().vp_manager.get_num_threads() );
   num_thread_local_devices_.resize( kernel().vp_manager.get_num_threads(), 0 );
   ensure_valid_thread_local_ids();
 }
@@ -76,6 +81,10 @@ NodeManager::initialize()
 void
 NodeManager::finalize()
 {
+  for ( thread t = 0; t < static_cast< thread >( population_engines_.size() ); ++t )
+  {
+    release_population_engines( t );
+  }
   destruct_nodes_();
 }
 
@@ -718,6 +727,66 @@ NodeManager::post_run_cleanup()
   }
 }
 
+void
+NodeManager::create_population_engines( thread t )
+{
+  assert( population_engines_[ t ].empty() );
+
+  // engine per model, 0 if the model does not provide one
+  std::map< int, PopulationEngine* > model_engines;
+
+  SparseNodeArray::const_iterator n;
+  for ( n = local_nodes_[ t ].begin(); n != local_nodes_[ t ].end(); ++n )
+  {
+    Node* node = n->get_node();
+    if ( node->is_frozen() )
+    {
+      continue;
+    }
+
+    const int model_id = node->get_model_id();
+    std::map< int, PopulationEngine* >::const_iterator it = model_engines.find( model_id );
+    if ( it == model_engines.end() )
+    {
+      PopulationEngine* engine = node->create_population_engine();
+      if ( engine != 0 )
+      {
+        population_engines_[ t ].push_back( engine );
+      }
+      it = model_engines.insert( std::make_pair( model_id, engine ) ).first;
+    }
+
+    if ( it->second != 0 and it->second->add_node( *node ) )
+    {
+      node->in_population_ = true;
+    }
+  }
+}
+
+void
+NodeManager::release_population_engines( thread t )
+{
+  if ( population_engines_[ t ].empty() )
+  {
+    return;
+  }
+
+  for ( std::vector< PopulationEngine* >::iterator it = population_engines_[ t ].begin();
+        it != population_engines_[ t ].end();
+        ++it )
+  {
+    ( *it )->release_nodes();
+    delete *it;
+  }
+  population_engines_[ t ].clear();
+
+  SparseNodeArray::const_iterator n;
+  for ( n = local_nodes_[ t ].begin(); n != local_nodes_[ t ].end(); ++n )
+  {
+    n->get_node()->in_population_ = false;
+  }
+}
+
 /**
  * This function is called only if the thread data structures are properly set
  * up.
@@ -796,10 +865,157 @@ NodeManager::set_status( index node_id, const DictionaryDatum& d )
   }
 }
 
+void
+NodeManager::write_checkpoint( std::ostream& os )
+{
+  // Model ranges in the order of creation, so that the restored nodes are
+  // assigned the same node IDs
+  std::vector< modelrange > ranges( kernel().modelrange_manager.begin(), kernel().modelrange_manager.end() );
+  write_checkpoint_value( os, ranges.size() );
+  for ( std::vector< modelrange >::const_iterator it = ranges.begin(); it != ranges.end(); ++it )
+  {
+    write_checkpoint_string( os, kernel().model_manager.get_model( it->get_model_id() )->get_name() );
+    write_checkpoint_value( os, it->get_first_node_id() );
+    write_checkpoint_value( os, it->get_last_node_id() );
+  }
+
+  // Entries of the status dictionary that are set by the kernel
+  std::vector< Name > kernel_entries;
+  kernel_entries.push_back( names::local );
+  kernel_entries.push_back( names::model );
+  kernel_entries.push_back( names::global_id );
+  kernel_entries.push_back( names::vp );
+  kernel_entries.push_back( names::element_type );
+  kernel_entries.push_back( names::node_uses_wfr );
+  kernel_entries.push_back( names::thread_local_id );
+  kernel_entries.push_back( names::thread );
+  kernel_entries.push_back( names::recordables );
+  kernel_entries.push_back( names::events );
+  kernel_entries.push_back( names::n_events );
+
+  std::vector< DictionaryDatum > model_defaults( kernel().model_manager.get_num_node_models() );
+
+  for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    write_checkpoint_value( os, local_nodes_[ t ].size() );
+    for ( SparseNodeArray::const_iterator it = local_nodes_[ t ].begin(); it != local_nodes_[ t ].end(); ++it )
+    {
+      Node* node = it->get_node();
+      const index model_id = node->get_model_id();
+      if ( not model_defaults[ model_id ].valid() )
+      {
+        model_defaults[ model_id ] = kernel().model_manager.get_model( model_id )->get_status();
+      }
+
+      DictionaryDatum status = node->get_status_base();
+      for ( std::vector< Name >::const_iterator name = kernel_entries.begin(); name != kernel_entries.end(); ++name )
+      {
+        status->remove( *name );
+      }
+
+      write_checkpoint_value( os, node->get_node_id() );
+      write_checkpoint_dictionary( os, status, model_defaults[ model_id ] );
+      node->write_checkpoint( os );
+    }
+  }
+}
+
+void
+NodeManager::read_checkpoint( std::istream& is )
+{
+  size_t num_ranges;
+  read_checkpoint_value( is, num_ranges );
+  for ( size_t i = 0; i < num_ranges; ++i )
+  {
+    std::string model_name;
+    index first_node_id;
+    index last_node_id;
+    read_checkpoint_string( is, model_name );
+    read_checkpoint_value( is, first_node_id );
+    read_checkpoint_value( is, last_node_id );
+
+    const Token model = kernel().model_manager.get_modeldict()->lookup( model_name );
+    if ( model.empty() )
+    {
+      throw UnknownModelName( model_name );
+    }
+
+    NodeCollectionPTR nc = add_node( getValue< long >( model ), last_node_id - first_node_id + 1 );
+    if ( ( *nc )[ 0 ] != first_node_id )
+    {
+      throw KernelException( "Node IDs in checkpoint do not match the node IDs of the restored nodes." );
+    }
+  }
+
+  for ( thread t = 0; t < kernel().vp_manager.get_num_threads(); ++t )
+  {
+    size_t num_nodes;
+    read_checkpoint_value( is, num_nodes );
+    for ( size_t i = 0; i < num_nodes; ++i )
+    {
+      index node_id;
+      read_checkpoint_value( is, node_id );
+      DictionaryDatum status( new Dictionary );
+      read_checkpoint_dictionary( is, status );
+
+      Node* node = local_nodes_[ t ].get_node_by_node_id( node_id );
+      if ( node == 0 )
+      {
+        throw KernelException( "Node in checkpoint is not local to the same thread as when it was written." );
+      }
+
+      node->set_status_base( status );
+      node->init_buffers();
+      node->read_checkpoint( is );
+    }
+  }
+}
+
 void
 NodeManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::network_size, size() );
+
+  // Nodes are allocated from per-thread memory pools of their models, the
+  // buffers of the nodes are allocated by the nodes themselves.
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< long > nodes_per_thread( num_threads, 0 );
+  std::vector< long > node_buffers_per_thread( num_threads, 0 );
+  for ( thread t = 0; t < num_threads; ++t )
+  {
+    for ( index model_id = 0; model_id < kernel().model_manager.get_num_node_models(); ++model_id )
+    {
+      const Model* model = kernel().model_manager.get_model( model_id );
+      nodes_per_thread[ t ] += model->mem_capacity( t ) * model->get_element_size();
+    }
+    if ( static_cast< size_t >( t ) < local_nodes_.size() )
+    {
+      nodes_per_thread[ t ] += local_nodes_[ t ].get_memory_usage();
+      for ( SparseNodeArray::const_iterator n = local_nodes_[ t ].begin(); n != local_nodes_[ t ].end(); ++n )
+      {
+        node_buffers_per_thread[ t ] += n->get_node()->get_buffer_memory();
+      }
+    }
+  }
+  def_memory_status( d, names::nodes, nodes_per_thread );
+  def_memory_status( d, names::node_buffers, node_buffers_per_thread );
+
+  if ( kernel().mpi_manager.is_dryrun_mode() )
+  {
+    // The ring buffers are resized to the delay extrema when the simulation
+    // is prepared; the ConnectionManager has updated the extrema in its
+    // get_status(), which is called before this function.
+    std::vector< long > node_buffers_forecast( num_threads, 0 );
+    for ( thread t = 0; t < static_cast< thread >( local_nodes_.size() ); ++t )
+    {
+      for ( SparseNodeArray::const_iterator n = local_nodes_[ t ].begin(); n != local_nodes_[ t ].end(); ++n )
+      {
+        node_buffers_forecast[ t ] += n->get_node()->get_buffer_memory_forecast();
+      }
+    }
+    def_memory_forecast( d, names::nodes, nodes_per_thread );
+    def_memory_forecast( d, names::node_buffers, node_buffers_forecast );
+  }
 }
 
 void
@@ -24,6 +24,7 @@
 #define NODE_MANAGER_H
 
 // C++ includes:
+#include <iosfwd>
 #include <vector>
 
 // Includes from libnestutil:
@@ -33,6 +34,7 @@
 #include "conn_builder.h"
 #include "node_collection.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "sparse_node_array.h"
 
 // Includes from sli:
@@ -212,6 +214,24 @@ public:
    */
   void post_run_cleanup();
 
+  /**
+   * Create the population engines of thread t and hand all thread-local
+   * nodes that an engine accepts over to it.
+   * @see PopulationEngine
+   */
+  void create_population_engines( thread t );
+
+  /**
+   * Write the state held by the population engines of thread t back into
+   * the nodes and delete the engines.
+   */
+  void release_population_engines( thread t );
+
+  /**
+   * Get population engines of thread t.
+   */
+  const std::vector< PopulationEngine* >& get_population_engines( thread t ) const;
+
   /**
    * Invoke finalize() on all nodes.
    */
@@ -235,6 +255,21 @@ public:
   bool have_nodes_changed() const;
   void set_have_nodes_changed( const bool changed );
 
+  /**
+   * Write all nodes to a checkpoint.
+   *
+   * For each node, the entries of its status dictionary that differ from
+   * the model defaults are written, followed by the state the node writes
+   * in Node::write_checkpoint().
+   */
+  void write_checkpoint( std::ostream& );
+
+  /**
+   * Re-create the nodes stored in a checkpoint.
+   * @see write_checkpoint()
+   */
+  void read_checkpoint( std::istream& );
+
 private:
   /**
    * Initialize the network data structures.
@@ -309,6 +344,9 @@ private:
                                                       //!< waveform relaxation
   //! Network size when wfr_nodes_vec_ was last updated
   index wfr_network_size_;
+
+  //! Engines updating nodes of one model together, one list per thread
+  std::vector< std::vector< PopulationEngine* > > population_engines_;
   size_t num_active_nodes_; //!< number of nodes created by prepare_nodes
 
   std::vector< index > num_thread_local_devices_; //!< stores number of thread local devices
@@ -338,6 +376,12 @@ NodeManager::get_wfr_nodes_on_thread( thread t ) const
   return wfr_nodes_vec_.at( t );
 }
 
+inline const std::vector< PopulationEngine* >&
+NodeManager::get_population_engines( thread t ) const
+{
+  return population_engines_[ t ];
+}
+
 inline bool
 NodeManager::wfr_is_used() const
 {
@@ -0,0 +1,95 @@
+/*
+ *  population_engine.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_ENGINE_H
+#define POPULATION_ENGINE_H
+
+// C++ includes:
+#include <cstddef>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+
+namespace nest
+{
+class Node;
+
+/**
+ * Base class for engines that update all thread-local neurons of one model
+ * together.
+ *
+ * If the kernel property population_update is set, the NodeManager asks the
+ * first thread-local node of each model for an engine at the beginning of
+ * every call to Run(), see Node::create_population_engine(). All further
+ * thread-local nodes of that model are then offered to the engine via
+ * add_node(). Nodes that are accepted are no longer updated through
+ * Node::update(); instead, the engine copies their state into contiguous
+ * arrays and advances all of them in one loop per time step. Nodes that an
+ * engine cannot handle, e.g. because of a parameter combination it does not
+ * support, are rejected and keep being updated individually.
+ *
+ * Input still arrives in the ring buffers of the individual nodes, and the
+ * engine emits spikes and records data on behalf of the nodes. At the end
+ * of Run(), release_nodes() writes the state back into the nodes, so that
+ * GetStatus() and SetStatus() see the same values as without the engine.
+ *
+ * Engines are created and used by a single thread only.
+ *
+ * @ingroup Network
+ */
+class PopulationEngine
+{
+public:
+  virtual ~PopulationEngine()
+  {
+  }
+
+  /**
+   * Take over the update of the given node.
+   * The node is guaranteed to be of the model that created the engine.
+   * @returns false if the node needs to be updated individually.
+   */
+  virtual bool add_node( Node& ) = 0;
+
+  /**
+   * Advance the state of all nodes of the engine from origin+from to
+   * origin+to, equivalently to Node::update().
+   */
+  virtual void update( Time const& origin, const long from, const long to ) = 0;
+
+  /**
+   * Write the state of all nodes back into the nodes.
+   */
+  virtual void release_nodes() = 0;
+
+protected:
+  /**
+   * Number of nodes that update() advances together over all steps of a
+   * slice. The state of one block should fit into the L1 cache, so that it
+   * is not reloaded from memory in every step.
+   */
+  static const size_t block_size_ = 64;
+};
+
+} // namespace
+
+#endif /* POPULATION_ENGINE_H */
@@ -20,9 +20,32 @@
  *
  */
 
+// Includes from nestkernel:
+#include "event.h"
+#include "exceptions.h"
+
 #include "recording_backend.h"
 
 const std::vector< Name > nest::RecordingBackend::NO_DOUBLE_VALUE_NAMES;
 const std::vector< Name > nest::RecordingBackend::NO_LONG_VALUE_NAMES;
 const std::vector< double > nest::RecordingBackend::NO_DOUBLE_VALUES;
 const std::vector< long > nest::RecordingBackend::NO_LONG_VALUES;
+
+void
+nest::RecordingBackend::get_device_columns( const RecordingDevice&, const bool, RecordingColumns& )
+{
+  throw BadParameter( "The recording backend does not keep events in memory." );
+}
+
+void
+nest::RecordingBackend::write_spikes( const RecordingDevice& device, const std::vector< RecordedSpike >& spikes )
+{
+  SpikeEvent event;
+  for ( const auto& spike : spikes )
+  {
+    event.set_sender_node_id( spike.sender );
+    event.set_stamp( Time( Time::step( spike.stamp ) ) );
+    event.set_offset( spike.offset );
+    write( device, event, NO_DOUBLE_VALUES, NO_LONG_VALUES );
+  }
+}
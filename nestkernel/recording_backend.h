@@ -26,6 +26,9 @@
 // C++ includes:
 #include <vector>
 
+// Includes from nestkernel:
+#include "nest_types.h"
+
 // Includes from sli:
 #include "dictdatum.h"
 #include "name.h"
@@ -35,6 +38,18 @@ namespace nest
 
 class RecordingDevice;
 class Event;
+struct RecordingColumns;
+
+/**
+ * Compact record of a spike, as collected by spike detectors during a
+ * time slice and passed to RecordingBackend::write_spikes().
+ */
+struct RecordedSpike
+{
+  index sender;  //!< Node ID of the sender
+  long stamp;    //!< Time stamp of the spike in steps
+  double offset; //!< Offset of the spike from the time stamp in ms
+};
 
 /**
  * Abstract base class for all NESTio recording backends
@@ -60,7 +75,9 @@ class Event;
  *
  * During the simulation, recording devices call IOManager::write() in
  * order to record data. These calls are forwarded to the backend, the
- * device is enrolled with. Cleanup on the user level finally calls
+ * device is enrolled with. Spike detectors instead collect their spikes
+ * and pass them to IOManager::write_spikes() once per time slice. Cleanup
+ * on the user level finally calls
  * the cleanup() function of all backends.
  *
  * @ingroup NESTio
@@ -246,6 +263,25 @@ public:
     const std::vector< double >& double_values,
     const std::vector< long >& long_values ) = 0;
 
+  /**
+   * Write the spikes collected by a spike detector during a time slice to
+   * the backend specific channel.
+   *
+   * This is called by the thread of the device once per time slice with
+   * all spikes the device received during the slice, each of them with
+   * multiplicity one. Backends can override it to look up the device only
+   * once per call. The default implementation calls write() for each
+   * spike.
+   *
+   * @param device the RecordingDevice, backend-specific channel to write to
+   * @param spikes the spikes to be written
+   *
+   * @see write()
+   *
+   * @ingroup NESTio
+   */
+  virtual void write_spikes( const RecordingDevice& device, const std::vector< RecordedSpike >& spikes );
+
   /**
    * Set the status of the recording backend using the key-value pairs
    * contained in the params dictionary.
@@ -318,6 +354,24 @@ public:
    */
   virtual void get_device_status( const RecordingDevice& device, DictionaryDatum& params ) const = 0;
 
+  /**
+   * Append the events stored for the given recording device to columns.
+   *
+   * This function is only implemented by backends that keep the recorded
+   * events in memory. If @p drain is true, the events are removed from
+   * the backend, which allows to move instead of copy them. The default
+   * implementation throws a BadParameter exception.
+   *
+   * @param device the recording device for which the events are returned
+   * @param drain whether to remove the events from the backend
+   * @param columns the columns to append the events to
+   *
+   * @see get_device_status()
+   *
+   * @ingroup NESTio
+   */
+  virtual void get_device_columns( const RecordingDevice& device, const bool drain, RecordingColumns& columns );
+
   static const std::vector< Name > NO_DOUBLE_VALUE_NAMES;
   static const std::vector< Name > NO_LONG_VALUE_NAMES;
   static const std::vector< double > NO_DOUBLE_VALUES;
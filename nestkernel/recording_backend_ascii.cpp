@@ -20,12 +20,18 @@
  *
  */
 
+// Generated includes:
+#include "config.h"
+
 // Includes from libnestutil:
 #include "compose.hpp"
 
 // Includes from nestkernel:
 #include "recording_device.h"
 #include "vp_manager_impl.h"
+#ifdef HAVE_ZLIB
+#include "compressed_stream.h"
+#endif
 
 // includes from sli:
 #include "dictutils.h"
@@ -35,24 +41,34 @@
 const unsigned int nest::RecordingBackendASCII::ASCII_REC_BACKEND_VERSION = 2;
 
 nest::RecordingBackendASCII::RecordingBackendASCII()
+  : writer_running_( false )
+  , stop_writer_requested_( false )
 {
 }
 
 nest::RecordingBackendASCII::~RecordingBackendASCII() throw()
 {
+  stop_writer_();
 }
 
 void
 nest::RecordingBackendASCII::initialize()
 {
-  data_map tmp( kernel().vp_manager.get_num_threads() );
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  data_map tmp( num_threads );
   device_data_.swap( tmp );
+
+  buffers_.clear();
+  for ( thread t = 0; t < num_threads; ++t )
+  {
+    buffers_.emplace_back( new ThreadBuffers() );
+  }
 }
 
 void
 nest::RecordingBackendASCII::finalize()
 {
-  // nothing to do
+  stop_writer_();
 }
 
 void
@@ -108,6 +124,8 @@ nest::RecordingBackendASCII::pre_run_hook()
 void
 nest::RecordingBackendASCII::post_run_hook()
 {
+  write_all_records_();
+
   for ( auto& inner : device_data_ )
   {
     for ( auto& device_data : inner )
@@ -120,12 +138,17 @@ nest::RecordingBackendASCII::post_run_hook()
 void
 nest::RecordingBackendASCII::post_step_hook()
 {
-  // nothing to do
+  if ( writer_running_ )
+  {
+    hand_over_( kernel().vp_manager.get_thread_id(), false );
+  }
 }
 
 void
 nest::RecordingBackendASCII::cleanup()
 {
+  stop_writer_();
+
   for ( auto& inner : device_data_ )
   {
     for ( auto& device_data : inner )
@@ -150,7 +173,156 @@ nest::RecordingBackendASCII::write( const RecordingDevice& device,
     return;
   }
 
-  device_data->second.write( event, double_values, long_values );
+  if ( writer_running_ )
+  {
+    buffers_[ t ]->filling.add( device_data->second, event, double_values, long_values );
+  }
+  else
+  {
+    device_data->second.write( event, double_values, long_values );
+  }
+}
+
+void
+nest::RecordingBackendASCII::write_spikes( const RecordingDevice& device, const std::vector< RecordedSpike >& spikes )
+{
+  const thread t = device.get_thread();
+  const index node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  for ( const auto& spike : spikes )
+  {
+    if ( writer_running_ )
+    {
+      buffers_[ t ]->filling.add( device_data->second, spike );
+    }
+    else
+    {
+      device_data->second.write_record(
+        spike.sender, spike.stamp, Time( Time::step( spike.stamp ) ).get_ms(), spike.offset, nullptr, 0, nullptr, 0 );
+    }
+  }
+}
+
+void
+nest::RecordingBackendASCII::start_writer_()
+{
+  assert( not writer_running_ );
+
+  stop_writer_requested_ = false;
+  writer_ = std::thread( &RecordingBackendASCII::run_writer_, this );
+  writer_running_ = true;
+}
+
+void
+nest::RecordingBackendASCII::stop_writer_()
+{
+  if ( not writer_running_ )
+  {
+    return;
+  }
+
+  write_all_records_();
+  {
+    std::lock_guard< std::mutex > lock( writer_mutex_ );
+    stop_writer_requested_ = true;
+  }
+  work_available_.notify_one();
+  writer_.join();
+  writer_running_ = false;
+}
+
+void
+nest::RecordingBackendASCII::run_writer_()
+{
+  std::unique_lock< std::mutex > lock( writer_mutex_ );
+  while ( true )
+  {
+    work_available_.wait( lock, [ this ] { return stop_writer_requested_ or has_busy_buffers_(); } );
+    if ( not has_busy_buffers_() )
+    {
+      return; // stop was requested and all records are written
+    }
+
+    lock.unlock();
+    for ( auto& buffers : buffers_ )
+    {
+      if ( buffers->draining_busy.load() )
+      {
+        buffers->draining.write_and_clear();
+        {
+          std::lock_guard< std::mutex > guard( writer_mutex_ );
+          buffers->draining_busy.store( false );
+        }
+        work_done_.notify_all();
+      }
+    }
+    lock.lock();
+  }
+}
+
+void
+nest::RecordingBackendASCII::hand_over_( const thread t, const bool wait )
+{
+  ThreadBuffers& buffers = *buffers_[ t ];
+  if ( buffers.filling.size() == 0 )
+  {
+    return;
+  }
+
+  if ( buffers.draining_busy.load() )
+  {
+    // keep filling the buffer as long as there is space left
+    if ( not wait and buffers.filling.size() < static_cast< size_t >( P_.buffer_size_ ) )
+    {
+      return;
+    }
+
+    std::unique_lock< std::mutex > lock( writer_mutex_ );
+    work_done_.wait( lock, [ &buffers ] { return not buffers.draining_busy.load(); } );
+  }
+
+  buffers.filling.swap( buffers.draining );
+  {
+    std::lock_guard< std::mutex > lock( writer_mutex_ );
+    buffers.draining_busy.store( true );
+  }
+  work_available_.notify_one();
+}
+
+void
+nest::RecordingBackendASCII::write_all_records_()
+{
+  if ( not writer_running_ )
+  {
+    return;
+  }
+
+  for ( size_t t = 0; t < buffers_.size(); ++t )
+  {
+    hand_over_( t, true );
+  }
+
+  std::unique_lock< std::mutex > lock( writer_mutex_ );
+  work_done_.wait( lock, [ this ] { return not has_busy_buffers_(); } );
+}
+
+bool
+nest::RecordingBackendASCII::has_busy_buffers_() const
+{
+  for ( const auto& buffers : buffers_ )
+  {
+    if ( buffers->draining_busy.load() )
+    {
+      return true;
+    }
+  }
+  return false;
 }
 
 const std::string
@@ -171,25 +343,41 @@ nest::RecordingBackendASCII::compute_vp_node_id_string_( const RecordingDevice&
 void
 nest::RecordingBackendASCII::prepare()
 {
+  bool has_devices = false;
   for ( auto& inner : device_data_ )
   {
     for ( auto& device_info : inner )
     {
       device_info.second.open_file();
+      has_devices = true;
     }
   }
+
+  if ( P_.asynchronous_ and has_devices )
+  {
+    start_writer_();
+  }
 }
 
 void
-nest::RecordingBackendASCII::set_status( const DictionaryDatum& )
+nest::RecordingBackendASCII::set_status( const DictionaryDatum& d )
 {
-  // nothing to do
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  if ( writer_running_ and ptmp.asynchronous_ != P_.asynchronous_ )
+  {
+    throw BadProperty( "Property asynchronous cannot be changed between Prepare and Cleanup." );
+  }
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
 }
 
 void
-nest::RecordingBackendASCII::get_status( DictionaryDatum& ) const
+nest::RecordingBackendASCII::get_status( DictionaryDatum& d ) const
 {
-  // nothing to do
+  P_.get( d );
 }
 
 void
@@ -219,6 +407,103 @@ nest::RecordingBackendASCII::get_device_status( const nest::RecordingDevice& dev
   }
 }
 
+/* ******************* Backend parameters ******************* */
+
+nest::RecordingBackendASCII::Parameters_::Parameters_()
+  : asynchronous_( true )
+  , buffer_size_( 65536 )
+{
+}
+
+void
+nest::RecordingBackendASCII::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::asynchronous ] = asynchronous_;
+  ( *d )[ names::buffer_size ] = buffer_size_;
+}
+
+void
+nest::RecordingBackendASCII::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< bool >( d, names::asynchronous, asynchronous_ );
+  updateValue< long >( d, names::buffer_size, buffer_size_ );
+
+  if ( buffer_size_ < 1 )
+  {
+    throw BadProperty( "buffer_size > 0 required." );
+  }
+}
+
+/* ******************* Record buffers for asynchronous output ******************* */
+
+nest::RecordingBackendASCII::ThreadBuffers::ThreadBuffers()
+  : draining_busy( false )
+{
+}
+
+void
+nest::RecordingBackendASCII::RecordBuffer::add( DeviceData& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  records_.push_back( { &device,
+    event.get_sender_node_id(),
+    event.get_stamp().get_steps(),
+    event.get_stamp().get_ms(),
+    event.get_offset(),
+    double_values.size(),
+    long_values.size() } );
+  double_values_.insert( double_values_.end(), double_values.begin(), double_values.end() );
+  long_values_.insert( long_values_.end(), long_values.begin(), long_values.end() );
+}
+
+void
+nest::RecordingBackendASCII::RecordBuffer::add( DeviceData& device, const RecordedSpike& spike )
+{
+  records_.push_back(
+    { &device, spike.sender, spike.stamp, Time( Time::step( spike.stamp ) ).get_ms(), spike.offset, 0, 0 } );
+}
+
+void
+nest::RecordingBackendASCII::RecordBuffer::write_and_clear()
+{
+  const double* double_value = double_values_.data();
+  const long* long_value = long_values_.data();
+  for ( const auto& record : records_ )
+  {
+    record.device->write_record( record.sender,
+      record.steps,
+      record.time,
+      record.offset,
+      double_value,
+      record.num_double_values,
+      long_value,
+      record.num_long_values );
+    double_value += record.num_double_values;
+    long_value += record.num_long_values;
+  }
+
+  // clearing keeps the capacity, so the buffers are not reallocated
+  records_.clear();
+  double_values_.clear();
+  long_values_.clear();
+}
+
+void
+nest::RecordingBackendASCII::RecordBuffer::swap( RecordBuffer& other )
+{
+  records_.swap( other.records_ );
+  double_values_.swap( other.double_values_ );
+  long_values_.swap( other.long_values_ );
+}
+
+size_t
+nest::RecordingBackendASCII::RecordBuffer::size() const
+{
+  return records_.size();
+}
+
 /* ******************* Device meta data class DeviceData ******************* */
 
 nest::RecordingBackendASCII::DeviceData::DeviceData( std::string modelname, std::string vp_node_id_string )
@@ -228,6 +513,9 @@ nest::RecordingBackendASCII::DeviceData::DeviceData( std::string modelname, std:
   , vp_node_id_string_( vp_node_id_string )
   , file_extension_( "dat" )
   , label_( "" )
+  , compressed_( false )
+  , compression_level_( 6 )
+  , file_()
 {
 }
 
@@ -242,7 +530,10 @@ nest::RecordingBackendASCII::DeviceData::set_value_names( const std::vector< Nam
 void
 nest::RecordingBackendASCII::DeviceData::flush_file()
 {
-  file_.flush();
+  if ( file_ )
+  {
+    file_->flush();
+  }
 }
 
 void
@@ -263,35 +554,45 @@ nest::RecordingBackendASCII::DeviceData::open_file()
   }
   test.close();
 
-  file_ = std::ofstream( filename.c_str() );
+#ifdef HAVE_ZLIB
+  if ( compressed_ )
+  {
+    file_.reset( new GzipFileStream( filename, compression_level_ ) );
+  }
+  else
+#endif
+  {
+    file_.reset( new std::ofstream( filename.c_str() ) );
+  }
 
-  if ( not file_.good() )
+  if ( not file_->good() )
   {
     std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
     LOG( M_ERROR, "RecordingBackendASCII::prepare()", msg );
     throw IOError();
   }
 
-  file_ << "# NEST version: " << NEST_VERSION_STRING << std::endl
-        << "# RecordingBackendASCII version: " << ASCII_REC_BACKEND_VERSION << std::endl;
+  std::ostream& file = *file_;
+  file << "# NEST version: " << NEST_VERSION_STRING << "\n"
+       << "# RecordingBackendASCII version: " << ASCII_REC_BACKEND_VERSION << "\n";
 
   const std::string timehead = ( time_in_steps_ ) ? "\ttime_step\ttime_offset" : "\ttime_ms";
-  file_ << std::fixed << std::setprecision( precision_ ) << "sender" << timehead;
+  file << std::fixed << std::setprecision( precision_ ) << "sender" << timehead;
   for ( auto& val : double_value_names_ )
   {
-    file_ << "\t" << val;
+    file << "\t" << val;
   }
   for ( auto& val : long_value_names_ )
   {
-    file_ << "\t" << val;
+    file << "\t" << val;
   }
-  file_ << std::endl;
+  file << std::endl;
 }
 
 void
 nest::RecordingBackendASCII::DeviceData::close_file()
 {
-  file_.close();
+  file_.reset(); // closes and, if compressed, completes the file
 }
 
 void
@@ -299,27 +600,48 @@ nest::RecordingBackendASCII::DeviceData::write( const Event& event,
   const std::vector< double >& double_values,
   const std::vector< long >& long_values )
 {
-  file_ << event.get_sender_node_id() << "\t";
+  write_record( event.get_sender_node_id(),
+    event.get_stamp().get_steps(),
+    event.get_stamp().get_ms(),
+    event.get_offset(),
+    double_values.data(),
+    double_values.size(),
+    long_values.data(),
+    long_values.size() );
+}
+
+void
+nest::RecordingBackendASCII::DeviceData::write_record( index sender,
+  long steps,
+  double time,
+  double offset,
+  const double* double_values,
+  size_t num_double_values,
+  const long* long_values,
+  size_t num_long_values )
+{
+  std::ostream& file = *file_;
+  file << sender << "\t";
 
   if ( time_in_steps_ )
   {
-    file_ << event.get_stamp().get_steps() << "\t" << event.get_offset();
+    file << steps << "\t" << offset;
   }
   else
   {
-    file_ << ( event.get_stamp().get_ms() - event.get_offset() );
+    file << ( time - offset );
   }
 
-  for ( auto& val : double_values )
+  for ( size_t i = 0; i < num_double_values; ++i )
   {
-    file_ << "\t" << val;
+    file << "\t" << double_values[ i ];
   }
-  for ( auto& val : long_values )
+  for ( size_t i = 0; i < num_long_values; ++i )
   {
-    file_ << "\t" << val;
+    file << "\t" << long_values[ i ];
   }
 
-  file_ << "\n";
+  file << "\n";
 }
 
 void
@@ -328,6 +650,8 @@ nest::RecordingBackendASCII::DeviceData::get_status( DictionaryDatum& d ) const
   ( *d )[ names::file_extension ] = file_extension_;
   ( *d )[ names::precision ] = precision_;
   ( *d )[ names::time_in_steps ] = time_in_steps_;
+  ( *d )[ names::compressed ] = compressed_;
+  ( *d )[ names::compression_level ] = compression_level_;
 
   std::string filename = compute_filename_();
   initialize_property_array( d, names::filenames );
@@ -341,6 +665,23 @@ nest::RecordingBackendASCII::DeviceData::set_status( const DictionaryDatum& d )
   updateValue< long >( d, names::precision, precision_ );
   updateValue< std::string >( d, names::label, label_ );
 
+  bool compressed = compressed_;
+  updateValue< bool >( d, names::compressed, compressed );
+#ifndef HAVE_ZLIB
+  if ( compressed )
+  {
+    throw BadProperty( "Compressed output requires NEST to be compiled with zlib." );
+  }
+#endif
+  long compression_level = compression_level_;
+  updateValue< long >( d, names::compression_level, compression_level );
+  if ( compression_level < 1 or compression_level > 9 )
+  {
+    throw BadProperty( "Property compression_level must be between 1 and 9." );
+  }
+  compressed_ = compressed;
+  compression_level_ = compression_level;
+
   bool time_in_steps = false;
   if ( updateValue< bool >( d, names::time_in_steps, time_in_steps ) )
   {
@@ -370,5 +711,10 @@ nest::RecordingBackendASCII::DeviceData::compute_filename_() const
 
   std::string data_prefix = kernel().io_manager.get_data_prefix();
 
-  return data_path + data_prefix + label + vp_node_id_string_ + "." + file_extension_;
+  std::string filename = data_path + data_prefix + label + vp_node_id_string_ + "." + file_extension_;
+  if ( compressed_ )
+  {
+    filename += ".gz";
+  }
+  return filename;
 }
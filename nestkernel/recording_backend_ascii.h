@@ -24,7 +24,12 @@
 #define RECORDING_BACKEND_ASCII_H
 
 // C++ includes:
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 #include "recording_backend.h"
 
@@ -104,11 +109,64 @@ point offset in ms from the next integer grid point.
    The number of decimal places for all decimal numbers written can be
    controlled using the recorder property ``precision``.
 
+Asynchronous output
++++++++++++++++++++
+
+By default, the records are not written to the files by the threads
+that update the network. Instead, each thread collects its records in
+a buffer, which it hands over to a background writer thread at the
+end of each time step, and continues with a second buffer. The writer
+thread formats the records and writes them to the files, so the files
+are identical to those written synchronously. A thread only waits for
+the writer thread if its buffer holds ``buffer_size`` records or more
+while the previous buffer has not been written yet, which bounds the
+memory used for buffering. All records are written to the files at
+the end of each call to ``Run``.
+
+Asynchronous output is controlled by the following properties of the
+backend, which are set in the dictionary ``recording_backends`` of the
+kernel status, e.g. ``SetKernelStatus({"recording_backends": {"ascii":
+{"asynchronous": False}}})``. They cannot be changed between ``Prepare``
+and ``Cleanup``.
+
+.. glossary::
+
+ asynchronous
+   A Boolean (default: *true*) that specifies whether the records are
+   written by a background writer thread.
+
+ buffer_size
+   An integer (default: *65536*) that specifies the number of records
+   per thread after which a thread waits for the writer thread.
+
+Compressed output
++++++++++++++++++
+
+If NEST was compiled with zlib, the files can be written gzip
+compressed by setting the device property ``compressed`` to *true*.
+The extension ``.gz`` is then appended to the filenames. Each thread
+compresses the records of its own devices into its own files, and in
+asynchronous mode, the compression is carried out by the background
+writer thread. At the end of each call to ``Run``, the compressed
+streams are flushed, so all records written so far can be read from
+the files, e.g. using ``zcat`` or the utility ``nest_ascii_reader``,
+which also merges the files of all threads and processes of a device.
+
 Parameter summary
 +++++++++++++++++
 
 .. glossary::
 
+ compressed
+   A Boolean (default: *false*) specifying whether the file is written
+   gzip compressed. Setting it to *true* requires NEST to be compiled
+   with zlib.
+
+ compression_level
+   An integer between 1 and 9 (default: *6*) that selects the trade-off
+   between the speed of the compression (1) and the size of the file
+   (9).
+
  file_extension
    A string (default: *"dat"*) that specifies the file name extension,
    without leading dot. The generic default was chosen, because the
@@ -147,6 +205,12 @@ namespace nest
  * (issued by the recorder's calibrate() function) and closed in
  * cleanup(), which is called on all registered recording backends by
  * IOManager::cleanup().
+ *
+ * In asynchronous mode, write() only appends the record to the filling
+ * buffer of the thread. In post_step_hook(), each thread swaps its filling
+ * buffer with its draining buffer once the writer thread has written the
+ * latter, so the simulation threads never share a buffer with each other
+ * and only synchronize with the writer thread if their buffer is full.
  */
 class RecordingBackendASCII : public RecordingBackend
 {
@@ -183,6 +247,7 @@ public:
   void post_step_hook() override;
 
   void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+  void write_spikes( const RecordingDevice&, const std::vector< RecordedSpike >& ) override;
 
   void set_status( const DictionaryDatum& ) override;
   void get_status( DictionaryDatum& ) const override;
@@ -201,6 +266,14 @@ private:
     void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
     void open_file();
     void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void write_record( index sender,
+      long steps,
+      double time,
+      double offset,
+      const double* double_values,
+      size_t num_double_values,
+      const long* long_values,
+      size_t num_long_values );
     void flush_file();
     void close_file();
     void get_status( DictionaryDatum& ) const;
@@ -213,7 +286,9 @@ private:
     std::string vp_node_id_string_;          //!< The vp and node ID component of the filename
     std::string file_extension_;             //!< File name extension without leading "."
     std::string label_;                      //!< The label of the device.
-    std::ofstream file_;                     //!< File stream to use for the device
+    bool compressed_;                        //!< Whether the file is written gzip compressed
+    long compression_level_;                 //!< zlib compression level from 1 (fastest) to 9 (smallest)
+    std::unique_ptr< std::ostream > file_;   //!< File stream to use for the device
     std::vector< Name > double_value_names_; //!< names for values of type double
     std::vector< Name > long_value_names_;   //!< names for values of type long
 
@@ -222,6 +297,72 @@ private:
 
   typedef std::vector< std::map< size_t, DeviceData > > data_map;
   data_map device_data_;
+
+  /**
+   * Records of the devices of one thread, stored until they are written by
+   * the writer thread. The values of all records are stored consecutively.
+   */
+  struct RecordBuffer
+  {
+    struct Record
+    {
+      DeviceData* device;
+      index sender;
+      long steps;
+      double time;
+      double offset;
+      size_t num_double_values;
+      size_t num_long_values;
+    };
+
+    void add( DeviceData&, const Event&, const std::vector< double >&, const std::vector< long >& );
+    void add( DeviceData&, const RecordedSpike& );
+    void write_and_clear();
+    void swap( RecordBuffer& );
+    size_t size() const;
+
+  private:
+    std::vector< Record > records_;
+    std::vector< double > double_values_;
+    std::vector< long > long_values_;
+  };
+
+  struct ThreadBuffers
+  {
+    ThreadBuffers();
+
+    RecordBuffer filling;              //!< Filled by the simulation thread
+    RecordBuffer draining;             //!< Written by the writer thread
+    std::atomic< bool > draining_busy; //!< Whether draining is waiting to be written
+  };
+
+  void start_writer_();
+  void stop_writer_();
+  void run_writer_();
+  void hand_over_( const thread t, const bool wait );
+  void write_all_records_();
+  bool has_busy_buffers_() const;
+
+  struct Parameters_
+  {
+    bool asynchronous_; //!< Whether records are written by the writer thread
+    long buffer_size_;  //!< Number of records per thread before waiting for the writer thread
+
+    Parameters_();
+
+    void get( DictionaryDatum& ) const;
+    void set( const DictionaryDatum& );
+  };
+
+  Parameters_ P_;
+
+  std::vector< std::unique_ptr< ThreadBuffers > > buffers_;
+  std::thread writer_;
+  std::mutex writer_mutex_;
+  std::condition_variable work_available_; //!< Signals busy buffers or stop_writer_requested_ to the writer
+  std::condition_variable work_done_;      //!< Signals buffers written by the writer
+  bool writer_running_;                    //!< Only changed outside of the simulation loop
+  bool stop_writer_requested_;             //!< Protected by writer_mutex_
 };
 
 } // namespace
@@ -0,0 +1,591 @@
+/*
+ *  recording_backend_binary.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// includes from sli:
+#include "dictutils.h"
+
+#include "recording_backend_binary.h"
+
+namespace
+{
+/**
+ * Length of the header of a column file in bytes. NumPy requires the data
+ * to start at a multiple of 64 bytes; 128 bytes leave enough room for the
+ * largest possible number of records in the shape.
+ */
+const size_t header_length = 128;
+
+/**
+ * Return the NumPy type string of a value of given kind and size in the
+ * byte order of this machine, e.g. "<f8".
+ */
+std::string
+numpy_dtype( const char kind, const size_t size )
+{
+  const uint16_t probe = 1;
+  const char byte_order = *reinterpret_cast< const char* >( &probe ) == 1 ? '<' : '>';
+  return String::compose( "%1%2%3", byte_order, kind, size );
+}
+}
+
+nest::RecordingBackendBinary::RecordingBackendBinary()
+  : files_opened_( false )
+{
+}
+
+nest::RecordingBackendBinary::~RecordingBackendBinary() throw()
+{
+}
+
+void
+nest::RecordingBackendBinary::initialize()
+{
+  data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+}
+
+void
+nest::RecordingBackendBinary::finalize()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::enroll( const RecordingDevice& device, const DictionaryDatum& params )
+{
+  const thread t = device.get_thread();
+  const index node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    std::string vp_node_id_string = compute_vp_node_id_string_( device );
+    std::string modelname = device.get_name();
+    auto p = device_data_[ t ].insert( std::make_pair( node_id, DeviceData( modelname, vp_node_id_string ) ) );
+    device_data = p.first;
+  }
+
+  device_data->second.set_status( params );
+}
+
+void
+nest::RecordingBackendBinary::disenroll( const RecordingDevice& device )
+{
+  const thread t = device.get_thread();
+  const thread node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data_[ t ].erase( device_data );
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_value_names( const RecordingDevice& device,
+  const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  const thread t = device.get_thread();
+  const thread node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  assert( device_data != device_data_[ t ].end() );
+  device_data->second.set_value_names( double_value_names, long_value_names );
+}
+
+void
+nest::RecordingBackendBinary::pre_run_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::post_run_hook()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.update_headers();
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::post_step_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::cleanup()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.close_files();
+    }
+  }
+  files_opened_ = false;
+}
+
+void
+nest::RecordingBackendBinary::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const thread t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  device_data->second.write( event, double_values, long_values );
+}
+
+const std::string
+nest::RecordingBackendBinary::compute_vp_node_id_string_( const RecordingDevice& device ) const
+{
+  const float num_vps = kernel().vp_manager.get_num_virtual_processes();
+  const float num_nodes = kernel().node_manager.size();
+  const int vp_digits = static_cast< int >( std::floor( std::log10( num_vps ) ) + 1 );
+  const int node_id_digits = static_cast< int >( std::floor( std::log10( num_nodes ) ) + 1 );
+
+  std::ostringstream vp_node_id_string;
+  vp_node_id_string << "-" << std::setfill( '0' ) << std::setw( node_id_digits ) << device.get_node_id() << "-"
+                    << std::setfill( '0' ) << std::setw( vp_digits ) << device.get_vp();
+
+  return vp_node_id_string.str();
+}
+
+void
+nest::RecordingBackendBinary::prepare()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_info : inner )
+    {
+      device_info.second.open_files( P_.chunk_size_ );
+    }
+  }
+  files_opened_ = true;
+}
+
+void
+nest::RecordingBackendBinary::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  if ( files_opened_ and ptmp.chunk_size_ != P_.chunk_size_ )
+  {
+    throw BadProperty( "Property chunk_size cannot be changed between Prepare and Cleanup." );
+  }
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+void
+nest::RecordingBackendBinary::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+}
+
+void
+nest::RecordingBackendBinary::check_device_status( const DictionaryDatum& params ) const
+{
+  DeviceData dd( "", "" );
+  dd.set_status( params ); // throws if params contains invalid entries
+}
+
+void
+nest::RecordingBackendBinary::get_device_defaults( DictionaryDatum& params ) const
+{
+  DeviceData dd( "", "" );
+  dd.get_status( params );
+}
+
+void
+nest::RecordingBackendBinary::get_device_status( const nest::RecordingDevice& device, DictionaryDatum& d ) const
+{
+  const thread t = device.get_thread();
+  const index node_id = device.get_node_id();
+
+  data_map::value_type::const_iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.get_status( d );
+  }
+}
+
+/* ******************* Backend parameters ******************* */
+
+nest::RecordingBackendBinary::Parameters_::Parameters_()
+  : chunk_size_( 1 << 18 )
+{
+}
+
+void
+nest::RecordingBackendBinary::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::chunk_size ] = chunk_size_;
+}
+
+void
+nest::RecordingBackendBinary::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< long >( d, names::chunk_size, chunk_size_ );
+
+  if ( chunk_size_ < 1 )
+  {
+    throw BadProperty( "chunk_size > 0 required." );
+  }
+}
+
+/* ******************* Memory-mapped column file ColumnFile ******************* */
+
+nest::RecordingBackendBinary::ColumnFile::ColumnFile( const std::string& filename,
+  const std::string& dtype,
+  size_t value_size )
+  : filename_( filename )
+  , dtype_( dtype )
+  , value_size_( value_size )
+  , chunk_size_( 0 )
+  , fd_( -1 )
+  , data_( NULL )
+  , capacity_( 0 )
+  , size_( 0 )
+{
+}
+
+nest::RecordingBackendBinary::ColumnFile::~ColumnFile()
+{
+  if ( fd_ >= 0 )
+  {
+    close();
+  }
+}
+
+void
+nest::RecordingBackendBinary::ColumnFile::open( size_t chunk_size )
+{
+  std::ifstream test( filename_.c_str() );
+  if ( test.good() && not kernel().io_manager.overwrite_files() )
+  {
+    std::string msg = String::compose(
+      "The file '%1' already exists and overwriting files is disabled. To overwrite files, set "
+      "the kernel property overwrite_files to true. To change the name or location of the file, "
+      "change the kernel properties data_path or data_prefix, or the device property label.",
+      filename_ );
+    LOG( M_ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+  test.close();
+
+  fd_ = ::open( filename_.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644 );
+  if ( fd_ < 0 )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename_ );
+    LOG( M_ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+
+  chunk_size_ = chunk_size;
+  size_ = 0;
+  map_( chunk_size_ );
+  update_header();
+}
+
+template < typename T >
+inline void
+nest::RecordingBackendBinary::ColumnFile::append( T value )
+{
+  assert( sizeof( T ) == value_size_ );
+
+  if ( size_ == capacity_ )
+  {
+    grow_();
+  }
+  std::memcpy( data_ + header_length + size_ * value_size_, &value, sizeof( T ) );
+  ++size_;
+}
+
+void
+nest::RecordingBackendBinary::ColumnFile::update_header()
+{
+  // The header is a Python dictionary literal padded with spaces, see the
+  // specification of the NumPy format, version 1.0.
+  std::string dict = String::compose( "{'descr': '%1', 'fortran_order': False, 'shape': (%2,), }", dtype_, size_ );
+  const size_t dict_length = header_length - 10;
+  assert( dict.size() < dict_length );
+  dict.resize( dict_length - 1, ' ' );
+  dict += '\n';
+
+  std::memcpy( data_, "\x93NUMPY\x01\x00", 8 );
+  data_[ 8 ] = static_cast< char >( dict_length & 0xff );
+  data_[ 9 ] = static_cast< char >( dict_length >> 8 );
+  std::memcpy( data_ + 10, dict.data(), dict_length );
+}
+
+void
+nest::RecordingBackendBinary::ColumnFile::close()
+{
+  update_header();
+  unmap_();
+
+  // remove the unused part of the last chunk
+  if ( ftruncate( fd_, header_length + size_ * value_size_ ) != 0 )
+  {
+    std::string msg = String::compose( "I/O error while truncating file '%1'.", filename_ );
+    LOG( M_ERROR, "RecordingBackendBinary::cleanup()", msg );
+  }
+  ::close( fd_ );
+  fd_ = -1;
+}
+
+const std::string&
+nest::RecordingBackendBinary::ColumnFile::get_filename() const
+{
+  return filename_;
+}
+
+void
+nest::RecordingBackendBinary::ColumnFile::grow_()
+{
+  unmap_();
+  map_( capacity_ + chunk_size_ );
+}
+
+void
+nest::RecordingBackendBinary::ColumnFile::map_( size_t capacity )
+{
+  const size_t length = header_length + capacity * value_size_;
+  if ( ftruncate( fd_, length ) != 0 )
+  {
+    std::string msg = String::compose( "I/O error while resizing file '%1'.", filename_ );
+    LOG( M_ERROR, "RecordingBackendBinary::write()", msg );
+    throw IOError();
+  }
+
+  void* data = mmap( NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0 );
+  if ( data == MAP_FAILED )
+  {
+    std::string msg = String::compose( "I/O error while mapping file '%1' into memory.", filename_ );
+    LOG( M_ERROR, "RecordingBackendBinary::write()", msg );
+    throw IOError();
+  }
+
+  data_ = static_cast< char* >( data );
+  capacity_ = capacity;
+}
+
+void
+nest::RecordingBackendBinary::ColumnFile::unmap_()
+{
+  if ( data_ != NULL )
+  {
+    munmap( data_, header_length + capacity_ * value_size_ );
+    data_ = NULL;
+  }
+}
+
+/* ******************* Device meta data class DeviceData ******************* */
+
+nest::RecordingBackendBinary::DeviceData::DeviceData( std::string modelname, std::string vp_node_id_string )
+  : modelname_( modelname )
+  , vp_node_id_string_( vp_node_id_string )
+  , label_( "" )
+{
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_value_names( const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  double_value_names_ = double_value_names;
+  long_value_names_ = long_value_names;
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::open_files( size_t chunk_size )
+{
+  const std::string int_dtype = numpy_dtype( 'i', sizeof( int64_t ) );
+  const std::string double_dtype = numpy_dtype( 'f', sizeof( double ) );
+
+  senders_.reset( new ColumnFile( compute_filename_( "senders" ), int_dtype, sizeof( int64_t ) ) );
+  time_steps_.reset( new ColumnFile( compute_filename_( "time_steps" ), int_dtype, sizeof( int64_t ) ) );
+  offsets_.reset( new ColumnFile( compute_filename_( "offsets" ), double_dtype, sizeof( double ) ) );
+
+  double_values_.clear();
+  for ( auto& val : double_value_names_ )
+  {
+    double_values_.emplace_back( new ColumnFile( compute_filename_( val.toString() ), double_dtype, sizeof( double ) ) );
+  }
+  long_values_.clear();
+  for ( auto& val : long_value_names_ )
+  {
+    long_values_.emplace_back( new ColumnFile( compute_filename_( val.toString() ), int_dtype, sizeof( int64_t ) ) );
+  }
+
+  senders_->open( chunk_size );
+  time_steps_->open( chunk_size );
+  offsets_->open( chunk_size );
+  for ( auto& column : double_values_ )
+  {
+    column->open( chunk_size );
+  }
+  for ( auto& column : long_values_ )
+  {
+    column->open( chunk_size );
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::write( const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  assert( double_values.size() == double_values_.size() );
+  assert( long_values.size() == long_values_.size() );
+
+  senders_->append< int64_t >( event.get_sender_node_id() );
+  time_steps_->append< int64_t >( event.get_stamp().get_steps() );
+  offsets_->append< double >( event.get_offset() );
+
+  for ( size_t i = 0; i < double_values.size(); ++i )
+  {
+    double_values_[ i ]->append< double >( double_values[ i ] );
+  }
+  for ( size_t i = 0; i < long_values.size(); ++i )
+  {
+    long_values_[ i ]->append< int64_t >( long_values[ i ] );
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::update_headers()
+{
+  if ( not senders_ )
+  {
+    return;
+  }
+
+  senders_->update_header();
+  time_steps_->update_header();
+  offsets_->update_header();
+  for ( auto& column : double_values_ )
+  {
+    column->update_header();
+  }
+  for ( auto& column : long_values_ )
+  {
+    column->update_header();
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::close_files()
+{
+  senders_.reset();
+  time_steps_.reset();
+  offsets_.reset();
+  double_values_.clear();
+  long_values_.clear();
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::get_status( DictionaryDatum& d ) const
+{
+  initialize_property_array( d, names::filenames );
+  for ( auto& filename : compute_filenames_() )
+  {
+    append_property( d, names::filenames, filename );
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_status( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::label, label_ );
+}
+
+std::string
+nest::RecordingBackendBinary::DeviceData::compute_filename_( const std::string& column ) const
+{
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  std::string label = label_;
+  if ( label.empty() )
+  {
+    label = modelname_;
+  }
+
+  std::string data_prefix = kernel().io_manager.get_data_prefix();
+
+  return data_path + data_prefix + label + vp_node_id_string_ + "." + column + ".npy";
+}
+
+std::vector< std::string >
+nest::RecordingBackendBinary::DeviceData::compute_filenames_() const
+{
+  std::vector< std::string > filenames;
+  filenames.push_back( compute_filename_( "senders" ) );
+  filenames.push_back( compute_filename_( "time_steps" ) );
+  filenames.push_back( compute_filename_( "offsets" ) );
+  for ( auto& val : double_value_names_ )
+  {
+    filenames.push_back( compute_filename_( val.toString() ) );
+  }
+  for ( auto& val : long_value_names_ )
+  {
+    filenames.push_back( compute_filename_( val.toString() ) );
+  }
+  return filenames;
+}
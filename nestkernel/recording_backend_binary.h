@@ -0,0 +1,264 @@
+/*
+ *  recording_backend_binary.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_BINARY_H
+#define RECORDING_BACKEND_BINARY_H
+
+// C++ includes:
+#include <memory>
+
+#include "recording_backend.h"
+
+/* BeginUserDocs: recording backend
+
+.. _binary_backend:
+
+Write data to memory-mapped binary files
+########################################
+
+The `binary` recording backend writes collected data persistently to
+binary files, storing each recorded quantity in a column of its own.
+Writing the data requires neither formatting nor parsing and the files
+can be mapped into memory for analysis, which makes this backend
+suitable for long simulations that record many events.
+
+The backend writes one file per recorded quantity per recording device
+per thread on each MPI process. Filenames are determined according to
+the following pattern:
+
+::
+
+   data_path/data_prefix(label|model_name)-node_id-vp.column.npy
+
+The components of the filename are the same as for the :ref:`ascii
+backend <ascii_backend>`, followed by the name of the column. The life
+of a file starts with the call to ``Prepare`` and ends with the call to
+``Cleanup``. Existing files are only overwritten if the kernel property
+``overwrite_files`` is set to *true*.
+
+Data format
++++++++++++
+
+Each file is written in the `NumPy format
+<https://numpy.org/doc/stable/reference/generated/numpy.lib.format.html>`_
+(version 1.0) and holds a one-dimensional array of fixed-width values in
+the byte order of the machine. The header of the file describes the data type and the
+number of records, so the file can be read without copying using
+
+::
+
+   numpy.load(filename, mmap_mode="r")
+
+The following columns are written for every device:
+
+* ``senders``: the node ID of the sender of the event (64 bit integer)
+* ``time_steps``: the time of the event in steps of the simulation
+  resolution (64 bit integer)
+* ``offsets``: the negative offset of the event in ms from the time
+  step (64 bit float). The time of the event in ms is given by the time
+  step times the resolution minus the offset.
+
+Each recorded floating point value and integer value is written to a
+column with the name of the value, e.g. ``V_m``, as 64 bit float or
+integer, respectively.
+
+The files are mapped into memory and grow by ``chunk_size`` records
+whenever they are full, which avoids a system call for every record.
+The number of records in the header is updated at the end of each call
+to ``Run``, so the data is available for immediate inspection. The
+files are truncated to their final size in ``Cleanup``.
+
+Parameter summary
++++++++++++++++++
+
+The following property of the backend is set in the dictionary
+``recording_backends`` of the kernel status, e.g.
+``SetKernelStatus({"recording_backends": {"binary": {"chunk_size":
+1048576}}})``. It cannot be changed between ``Prepare`` and ``Cleanup``.
+
+.. glossary::
+
+ chunk_size
+   An integer (default: *262144*) that specifies the number of records
+   by which a file grows when it is full.
+
+The following properties are set on the recording device.
+
+.. glossary::
+
+ filenames
+   A list of the filenames where data is recorded to. This list has one
+   entry per column and is a read-only property.
+
+ label
+   A string (default: *""*) that replaces the model name component in
+   the filename if it is set.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Binary specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendBinary maintains one set of column files for every
+ * recording device instance on every thread, analogous to
+ * RecordingBackendASCII. Each column is a file that is mapped into memory
+ * in prepare(); write() copies the values of a record into the mappings
+ * without any formatting and without system calls, unless a file has to
+ * grow.
+ */
+class RecordingBackendBinary : public RecordingBackend
+{
+public:
+  RecordingBackendBinary();
+
+  ~RecordingBackendBinary() throw();
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  void prepare() override;
+
+  void cleanup() override;
+
+  void pre_run_hook() override;
+
+  /**
+   * Update the headers of all files after a single call to Run
+   */
+  void post_run_hook() override;
+
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  const std::string compute_vp_node_id_string_( const RecordingDevice& device ) const;
+
+  /**
+   * A file in NumPy format that holds one column of fixed-width values.
+   *
+   * The file is mapped into memory as a whole. The header is padded to a
+   * fixed length, so the number of records can be updated in place.
+   */
+  class ColumnFile
+  {
+  public:
+    ColumnFile( const std::string& filename, const std::string& dtype, size_t value_size );
+    ~ColumnFile();
+
+    ColumnFile( const ColumnFile& ) = delete;
+    ColumnFile& operator=( const ColumnFile& ) = delete;
+
+    void open( size_t chunk_size );
+
+    template < typename T >
+    void append( T value );
+
+    void update_header();
+    void close();
+
+    const std::string& get_filename() const;
+
+  private:
+    void grow_();
+    void map_( size_t capacity );
+    void unmap_();
+
+    std::string filename_;
+    std::string dtype_; //!< NumPy type string of the values, e.g. "<f8"
+    size_t value_size_; //!< Size of a value in bytes
+    size_t chunk_size_; //!< Number of records by which the file grows
+    int fd_;            //!< File descriptor, -1 if the file is closed
+    char* data_;        //!< Mapping of the whole file
+    size_t capacity_;   //!< Number of records that fit into the file
+    size_t size_;       //!< Number of records written
+  };
+
+  struct DeviceData
+  {
+    DeviceData() = delete;
+    DeviceData( std::string, std::string );
+    void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
+    void open_files( size_t chunk_size );
+    void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void update_headers();
+    void close_files();
+    void get_status( DictionaryDatum& ) const;
+    void set_status( const DictionaryDatum& );
+
+  private:
+    std::string modelname_;                  //!< File name up to but not including the "."
+    std::string vp_node_id_string_;          //!< The vp and node ID component of the filename
+    std::string label_;                      //!< The label of the device.
+    std::vector< Name > double_value_names_; //!< names for values of type double
+    std::vector< Name > long_value_names_;   //!< names for values of type long
+
+    std::unique_ptr< ColumnFile > senders_;
+    std::unique_ptr< ColumnFile > time_steps_;
+    std::unique_ptr< ColumnFile > offsets_;
+    std::vector< std::unique_ptr< ColumnFile > > double_values_;
+    std::vector< std::unique_ptr< ColumnFile > > long_values_;
+
+    std::string compute_filename_( const std::string& column ) const; //!< Compose and return the filename
+    std::vector< std::string > compute_filenames_() const;            //!< Filenames of all columns
+  };
+
+  typedef std::vector< std::map< size_t, DeviceData > > data_map;
+  data_map device_data_;
+
+  struct Parameters_
+  {
+    long chunk_size_; //!< Number of records by which files grow
+
+    Parameters_();
+
+    void get( DictionaryDatum& ) const;
+    void set( const DictionaryDatum& );
+  };
+
+  Parameters_ P_;
+
+  bool files_opened_; //!< Whether the files are open, i.e. between prepare() and cleanup()
+};
+
+} // namespace
+
+#endif // RECORDING_BACKEND_BINARY_H
@@ -20,6 +20,10 @@
  *
  */
 
+// C++ includes:
+#include <cmath>
+#include <limits>
+
 // Includes from nestkernel:
 #include "recording_device.h"
 #include "vp_manager_impl.h"
@@ -59,6 +63,7 @@ nest::RecordingBackendMemory::enroll( const RecordingDevice& device, const Dicti
     device_data = p.first;
   }
 
+  device_data->second.set_window( device.get_start(), device.get_stop() );
   device_data->second.set_status( params );
 }
 
@@ -112,6 +117,19 @@ nest::RecordingBackendMemory::write( const RecordingDevice& device,
   device_data_[ t ][ node_id ].push_back( event, double_values, long_values );
 }
 
+void
+nest::RecordingBackendMemory::write_spikes( const RecordingDevice& device, const std::vector< RecordedSpike >& spikes )
+{
+  thread t = device.get_thread();
+  index node_id = device.get_node_id();
+
+  DeviceData& device_data = device_data_[ t ][ node_id ];
+  for ( const auto& spike : spikes )
+  {
+    device_data.push_back( spike );
+  }
+}
+
 void
 nest::RecordingBackendMemory::check_device_status( const DictionaryDatum& params ) const
 {
@@ -139,6 +157,21 @@ nest::RecordingBackendMemory::get_device_status( const RecordingDevice& device,
   }
 }
 
+void
+nest::RecordingBackendMemory::get_device_columns( const RecordingDevice& device,
+  const bool drain,
+  RecordingColumns& columns )
+{
+  const thread t = device.get_thread();
+  const index node_id = device.get_node_id();
+
+  const auto device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.get_columns( drain, columns );
+  }
+}
+
 void
 nest::RecordingBackendMemory::post_run_hook()
 {
@@ -169,11 +202,81 @@ nest::RecordingBackendMemory::prepare()
   // nothing to do
 }
 
+/* ******************* Chunked storage of recorded values ******************* */
+
+template < typename T >
+inline void
+nest::RecordingBackendMemory::Column< T >::push_back( const T value, const size_t chunk_size )
+{
+  if ( chunks_.empty() or chunks_.back().size() == chunks_.back().capacity() )
+  {
+    chunks_.emplace_back();
+    chunks_.back().reserve( chunk_size );
+  }
+  chunks_.back().push_back( value );
+}
+
+template < typename T >
+size_t
+nest::RecordingBackendMemory::Column< T >::size() const
+{
+  size_t size = 0;
+  for ( const auto& chunk : chunks_ )
+  {
+    size += chunk.size();
+  }
+  return size;
+}
+
+template < typename T >
+void
+nest::RecordingBackendMemory::Column< T >::clear()
+{
+  std::vector< std::vector< T > >().swap( chunks_ );
+}
+
+template < typename T >
+void
+nest::RecordingBackendMemory::Column< T >::append_to( std::vector< T >& values ) const
+{
+  values.reserve( values.size() + size() );
+  for ( const auto& chunk : chunks_ )
+  {
+    values.insert( values.end(), chunk.begin(), chunk.end() );
+  }
+}
+
+template < typename T >
+void
+nest::RecordingBackendMemory::Column< T >::move_to( std::vector< T >& values )
+{
+  if ( values.empty() and chunks_.size() == 1 )
+  {
+    // the only chunk becomes the result without copying
+    values.swap( chunks_.front() );
+  }
+  else
+  {
+    // each chunk is freed as soon as it is copied to limit the peak memory
+    values.reserve( values.size() + size() );
+    for ( auto& chunk : chunks_ )
+    {
+      values.insert( values.end(), chunk.begin(), chunk.end() );
+      std::vector< T >().swap( chunk );
+    }
+  }
+  clear();
+}
+
 /* ******************* Device meta data class DeviceInfo ******************* */
 
 nest::RecordingBackendMemory::DeviceData::DeviceData()
   : time_in_steps_( false )
+  , expected_rate_( 0.0 )
+  , window_ms_( std::numeric_limits< double >::infinity() )
+  , chunk_size_( 0 )
 {
+  update_chunk_size_();
 }
 
 void
@@ -187,33 +290,105 @@ nest::RecordingBackendMemory::DeviceData::set_value_names( const std::vector< Na
   long_values_.resize( long_value_names.size() );
 }
 
+void
+nest::RecordingBackendMemory::DeviceData::set_window( const Time& start, const Time& stop )
+{
+  if ( stop.is_finite() )
+  {
+    window_ms_ = ( stop - start ).get_ms();
+  }
+  else
+  {
+    window_ms_ = std::numeric_limits< double >::infinity();
+  }
+  update_chunk_size_();
+}
+
+void
+nest::RecordingBackendMemory::DeviceData::update_chunk_size_()
+{
+  const size_t default_chunk_size = 1024;
+
+  if ( expected_rate_ > 0.0 )
+  {
+    // without a stop time, a chunk holds the events of one second
+    const double window_ms = std::isfinite( window_ms_ ) ? window_ms_ : 1000.0;
+    chunk_size_ = std::max( static_cast< size_t >( std::ceil( expected_rate_ * window_ms / 1000.0 ) ), size_t( 1 ) );
+  }
+  else
+  {
+    chunk_size_ = default_chunk_size;
+  }
+}
+
 void
 nest::RecordingBackendMemory::DeviceData::push_back( const Event& event,
   const std::vector< double >& double_values,
   const std::vector< long >& long_values )
 {
-  senders_.push_back( event.get_sender_node_id() );
+  senders_.push_back( event.get_sender_node_id(), chunk_size_ );
 
   if ( time_in_steps_ )
   {
-    times_steps_.push_back( event.get_stamp().get_steps() );
-    times_offset_.push_back( event.get_offset() );
+    times_steps_.push_back( event.get_stamp().get_steps(), chunk_size_ );
+    times_offset_.push_back( event.get_offset(), chunk_size_ );
   }
   else
   {
-    times_ms_.push_back( event.get_stamp().get_ms() - event.get_offset() );
+    times_ms_.push_back( event.get_stamp().get_ms() - event.get_offset(), chunk_size_ );
   }
 
   for ( size_t i = 0; i < double_values.size(); ++i )
   {
-    double_values_[ i ].push_back( double_values[ i ] );
+    double_values_[ i ].push_back( double_values[ i ], chunk_size_ );
   }
   for ( size_t i = 0; i < long_values.size(); ++i )
   {
-    long_values_[ i ].push_back( long_values[ i ] );
+    long_values_[ i ].push_back( long_values[ i ], chunk_size_ );
   }
 }
 
+void
+nest::RecordingBackendMemory::DeviceData::push_back( const RecordedSpike& spike )
+{
+  senders_.push_back( spike.sender, chunk_size_ );
+
+  if ( time_in_steps_ )
+  {
+    times_steps_.push_back( spike.stamp, chunk_size_ );
+    times_offset_.push_back( spike.offset, chunk_size_ );
+  }
+  else
+  {
+    times_ms_.push_back( Time( Time::step( spike.stamp ) ).get_ms() - spike.offset, chunk_size_ );
+  }
+}
+
+namespace
+{
+/**
+ * Return the vector of the property IntVectorDatum of the given name.
+ */
+std::vector< long >&
+int_property_vector( DictionaryDatum& d, Name propname )
+{
+  IntVectorDatum* vd = dynamic_cast< IntVectorDatum* >( d->lookup( propname ).datum() );
+  assert( vd != 0 );
+  return **vd;
+}
+
+/**
+ * Return the vector of the property DoubleVectorDatum of the given name.
+ */
+std::vector< double >&
+double_property_vector( DictionaryDatum& d, Name propname )
+{
+  DoubleVectorDatum* vd = dynamic_cast< DoubleVectorDatum* >( d->lookup( propname ).datum() );
+  assert( vd != 0 );
+  return **vd;
+}
+}
+
 void
 nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d ) const
 {
@@ -230,34 +405,35 @@ nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d ) const
   }
 
   initialize_property_intvector( events, names::senders );
-  append_property( events, names::senders, senders_ );
+  senders_.append_to( int_property_vector( events, names::senders ) );
 
   if ( time_in_steps_ )
   {
     initialize_property_intvector( events, names::times );
-    append_property( events, names::times, times_steps_ );
+    times_steps_.append_to( int_property_vector( events, names::times ) );
 
     initialize_property_doublevector( events, names::offsets );
-    append_property( events, names::offsets, times_offset_ );
+    times_offset_.append_to( double_property_vector( events, names::offsets ) );
   }
   else
   {
     initialize_property_doublevector( events, names::times );
-    append_property( events, names::times, times_ms_ );
+    times_ms_.append_to( double_property_vector( events, names::times ) );
   }
 
   for ( size_t i = 0; i < double_values_.size(); ++i )
   {
     initialize_property_doublevector( events, double_value_names_[ i ] );
-    append_property( events, double_value_names_[ i ], double_values_[ i ] );
+    double_values_[ i ].append_to( double_property_vector( events, double_value_names_[ i ] ) );
   }
   for ( size_t i = 0; i < long_values_.size(); ++i )
   {
     initialize_property_intvector( events, long_value_names_[ i ] );
-    append_property( events, long_value_names_[ i ], long_values_[ i ] );
+    long_values_[ i ].append_to( int_property_vector( events, long_value_names_[ i ] ) );
   }
 
   ( *d )[ names::time_in_steps ] = time_in_steps_;
+  ( *d )[ names::expected_rate ] = expected_rate_;
 }
 
 void
@@ -274,6 +450,17 @@ nest::RecordingBackendMemory::DeviceData::set_status( const DictionaryDatum& d )
     time_in_steps_ = time_in_steps;
   }
 
+  double expected_rate = expected_rate_;
+  if ( updateValue< double >( d, names::expected_rate, expected_rate ) )
+  {
+    if ( expected_rate < 0.0 )
+    {
+      throw BadProperty( "expected_rate >= 0 required." );
+    }
+    expected_rate_ = expected_rate;
+    update_chunk_size_();
+  }
+
   size_t n_events = 1;
   if ( updateValue< long >( d, names::n_events, n_events ) and n_events == 0 )
   {
@@ -281,6 +468,59 @@ nest::RecordingBackendMemory::DeviceData::set_status( const DictionaryDatum& d )
   }
 }
 
+void
+nest::RecordingBackendMemory::DeviceData::get_columns( const bool drain, RecordingColumns& columns )
+{
+  if ( columns.double_value_names.empty() and columns.long_value_names.empty() )
+  {
+    for ( const auto& name : double_value_names_ )
+    {
+      columns.double_value_names.push_back( name.toString() );
+    }
+    for ( const auto& name : long_value_names_ )
+    {
+      columns.long_value_names.push_back( name.toString() );
+    }
+    columns.double_values.resize( double_values_.size() );
+    columns.long_values.resize( long_values_.size() );
+  }
+  assert( columns.double_values.size() == double_values_.size() );
+  assert( columns.long_values.size() == long_values_.size() );
+
+  columns.time_in_steps = time_in_steps_;
+
+  if ( drain )
+  {
+    senders_.move_to( columns.senders );
+    times_ms_.move_to( columns.times );
+    times_steps_.move_to( columns.time_steps );
+    times_offset_.move_to( columns.offsets );
+    for ( size_t i = 0; i < double_values_.size(); ++i )
+    {
+      double_values_[ i ].move_to( columns.double_values[ i ] );
+    }
+    for ( size_t i = 0; i < long_values_.size(); ++i )
+    {
+      long_values_[ i ].move_to( columns.long_values[ i ] );
+    }
+  }
+  else
+  {
+    senders_.append_to( columns.senders );
+    times_ms_.append_to( columns.times );
+    times_steps_.append_to( columns.time_steps );
+    times_offset_.append_to( columns.offsets );
+    for ( size_t i = 0; i < double_values_.size(); ++i )
+    {
+      double_values_[ i ].append_to( columns.double_values[ i ] );
+    }
+    for ( size_t i = 0; i < long_values_.size(); ++i )
+    {
+      long_values_[ i ].append_to( columns.long_values[ i ] );
+    }
+  }
+}
+
 void
 nest::RecordingBackendMemory::DeviceData::clear()
 {
@@ -24,7 +24,9 @@
 #define RECORDING_BACKEND_MEMORY_H
 
 // Includes from nestkernel:
+#include "nest_time.h"
 #include "recording_backend.h"
+#include "recording_columns.h"
 
 /* BeginUserDocs: recording backend
 
@@ -61,6 +63,27 @@ be read out of the `n_events` entry in the status dictionary of the
 recording device. To delete data from memory, `n_events` can be set to
 0. Other values cannot be set.
 
+Memory usage and streaming
+++++++++++++++++++++++++++
+
+Events are stored in chunks, which are allocated as needed and never
+moved once allocated. The size of the chunks is derived from the
+property ``expected_rate``, the number of events per second the device
+is expected to record, and from the time window of the device given
+by ``start`` and ``stop``. If the expected rate is known and ``stop``
+is set, all events fit into a single chunk, which is allocated with
+the first event. Without ``stop``, a chunk holds the events of one
+second of simulated time.
+
+``GetRecordingArrays`` retrieves the recorded events column-wise. In
+PyNEST, ``nest.GetRecordingArrays(recorder, drain)`` returns NumPy
+arrays that share their memory with the kernel instead of copying the
+data. If ``drain`` is *true*, the events are removed from the backend
+and the chunks are handed over without copying them wherever possible.
+Draining the events between calls to ``Run`` thus keeps the memory
+used by long simulations constant. Draining does not reset
+``n_events``.
+
 Parameter summary
 +++++++++++++++++
 
@@ -73,6 +96,12 @@ Parameter summary
    recording, the format of which depends on the setting of
    ``time_in_steps``.
 
+ expected_rate
+   A double (default: *0.0*) that specifies the number of events per
+   second of simulated time the device is expected to record, which is
+   used to size the chunks of memory the events are stored in. If it is
+   zero, chunks hold 1024 events.
+
  n_events
    The number of events collected or sampled since the last reset of
    `n_events`. By setting `n_events` to 0, all events recorded so far
@@ -129,6 +158,7 @@ public:
   void cleanup() override;
 
   void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+  void write_spikes( const RecordingDevice&, const std::vector< RecordedSpike >& ) override;
 
   void pre_run_hook() override;
 
@@ -144,26 +174,60 @@ public:
   void get_device_defaults( DictionaryDatum& ) const override;
   void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
 
+  void get_device_columns( const RecordingDevice& device, const bool drain, RecordingColumns& columns ) override;
+
 private:
+  /**
+   * Values of one recorded quantity, stored in chunks.
+   *
+   * A chunk is allocated with its final capacity and never reallocated, so
+   * storing a value never copies the values stored before. Chunks can be
+   * handed over as a whole when the values are drained.
+   */
+  template < typename T >
+  class Column
+  {
+  public:
+    void push_back( const T value, const size_t chunk_size );
+    size_t size() const;
+    void clear();
+
+    //! Append all values to the given vector, keeping them in the column
+    void append_to( std::vector< T >& values ) const;
+
+    //! Append all values to the given vector and remove them from the column
+    void move_to( std::vector< T >& values );
+
+  private:
+    std::vector< std::vector< T > > chunks_;
+  };
+
   struct DeviceData
   {
     DeviceData();
     void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
+    void set_window( const Time& start, const Time& stop );
     void push_back( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void push_back( const RecordedSpike& );
     void get_status( DictionaryDatum& ) const;
     void set_status( const DictionaryDatum& );
+    void get_columns( const bool drain, RecordingColumns& columns );
 
   private:
     void clear();
-    std::vector< long > senders_;                        //!< sender node IDs of the events
-    std::vector< double > times_ms_;                     //!< times of registered events in ms
-    std::vector< long > times_steps_;                    //!< times of registered events in steps
-    std::vector< double > times_offset_;                 //!< offsets of registered events if time_in_steps_
-    std::vector< Name > double_value_names_;             //!< names for values of type double
-    std::vector< Name > long_value_names_;               //!< names for values of type long
-    std::vector< std::vector< double > > double_values_; //!< recorded values of type double, one vector per value
-    std::vector< std::vector< long > > long_values_;     //!< recorded values of type long, one vector per value
-    bool time_in_steps_;                                 //!< Should time be recorded in steps (ms if false)
+    void update_chunk_size_();
+    std::vector< Name > double_value_names_;        //!< names for values of type double
+    std::vector< Name > long_value_names_;          //!< names for values of type long
+    Column< long > senders_;                        //!< sender node IDs of the events
+    Column< double > times_ms_;                     //!< times of registered events in ms
+    Column< long > times_steps_;                    //!< times of registered events in steps
+    Column< double > times_offset_;                 //!< offsets of registered events if time_in_steps_
+    std::vector< Column< double > > double_values_; //!< recorded values of type double, one column per value
+    std::vector< Column< long > > long_values_;     //!< recorded values of type long, one column per value
+    bool time_in_steps_;                            //!< Should time be recorded in steps (ms if false)
+    double expected_rate_;                          //!< Expected number of events per second
+    double window_ms_;                              //!< Length of the recording window, infinite if unbounded
+    size_t chunk_size_;                             //!< Number of events per chunk
   };
 
   typedef std::vector< std::map< size_t, DeviceData > > device_data_map;
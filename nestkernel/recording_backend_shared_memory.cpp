@@ -0,0 +1,360 @@
+/*
+ *  recording_backend_shared_memory.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C includes:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// C++ includes:
+#include <cstring>
+#include <new>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "exceptions.h"
+#include "kernel_manager.h"
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
+#include "recording_backend_shared_memory.h"
+
+nest::RecordingBackendSharedMemory::RecordingBackendSharedMemory()
+  : segment_()
+  , data_( NULL )
+  , size_( 0 )
+  , header_( NULL )
+{
+}
+
+nest::RecordingBackendSharedMemory::~RecordingBackendSharedMemory() throw()
+{
+  finalize();
+}
+
+void
+nest::RecordingBackendSharedMemory::initialize()
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::set< index > >( num_threads ).swap( devices_ );
+  std::vector< ThreadBuffer >( num_threads ).swap( buffers_ );
+}
+
+void
+nest::RecordingBackendSharedMemory::finalize()
+{
+  if ( data_ )
+  {
+    munmap( data_, size_ );
+    shm_unlink( segment_.c_str() );
+    data_ = NULL;
+    header_ = NULL;
+    size_ = 0;
+    segment_.clear();
+  }
+}
+
+void
+nest::RecordingBackendSharedMemory::enroll( const RecordingDevice& device, const DictionaryDatum& )
+{
+  devices_[ device.get_thread() ].insert( device.get_node_id() );
+}
+
+void
+nest::RecordingBackendSharedMemory::disenroll( const RecordingDevice& device )
+{
+  devices_[ device.get_thread() ].erase( device.get_node_id() );
+}
+
+void
+nest::RecordingBackendSharedMemory::set_value_names( const RecordingDevice& device,
+  const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  if ( double_value_names.size() + long_value_names.size() > static_cast< size_t >( P_.max_values_ ) )
+  {
+    throw BadProperty( String::compose(
+      "Device %1 records %2 values, but the shared_memory recording backend "
+      "only stores max_values = %3 values per record.",
+      device.get_node_id(),
+      double_value_names.size() + long_value_names.size(),
+      P_.max_values_ ) );
+  }
+}
+
+void
+nest::RecordingBackendSharedMemory::prepare()
+{
+  if ( data_ )
+  {
+    return; // the segment persists across calls to Prepare
+  }
+
+  for ( const auto& devices : devices_ )
+  {
+    if ( not devices.empty() )
+    {
+      create_segment_();
+      return;
+    }
+  }
+}
+
+void
+nest::RecordingBackendSharedMemory::create_segment_()
+{
+  const std::string segment = String::compose( "%1_%2", P_.segment_name_, kernel().mpi_manager.get_rank() );
+  const size_t slot_size = shared_memory_stream_slot_size( P_.max_values_ );
+  const size_t size = shared_memory_stream_data_offset + P_.capacity_ * slot_size;
+
+  // A segment left over from a crashed simulation is replaced.
+  shm_unlink( segment.c_str() );
+  const int fd = shm_open( segment.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644 );
+  if ( fd < 0 )
+  {
+    std::string msg = String::compose( "I/O error while creating shared-memory segment '%1'.", segment );
+    LOG( M_ERROR, "RecordingBackendSharedMemory::prepare()", msg );
+    throw IOError();
+  }
+
+  void* data = MAP_FAILED;
+  if ( ftruncate( fd, size ) == 0 )
+  {
+    data = mmap( NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  }
+  close( fd ); // the mapping remains valid
+  if ( data == MAP_FAILED )
+  {
+    shm_unlink( segment.c_str() );
+    std::string msg = String::compose( "I/O error while mapping shared-memory segment '%1'.", segment );
+    LOG( M_ERROR, "RecordingBackendSharedMemory::prepare()", msg );
+    throw IOError();
+  }
+
+  // The segment is filled with zeros by ftruncate(), so all record slots
+  // are marked as not written.
+  segment_ = segment;
+  data_ = static_cast< char* >( data );
+  size_ = size;
+  header_ = new ( data_ ) SharedMemoryStreamHeader;
+  header_->capacity = P_.capacity_;
+  header_->slot_size = slot_size;
+  header_->max_values = P_.max_values_;
+  header_->resolution = Time::get_resolution().get_ms();
+  header_->write_sequence.store( 0 );
+
+  // Consumers check the magic string last, so it is written last.
+  std::atomic_thread_fence( std::memory_order_release );
+  std::memcpy( header_->magic, shared_memory_stream_magic, sizeof( header_->magic ) );
+}
+
+void
+nest::RecordingBackendSharedMemory::cleanup()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSharedMemory::pre_run_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSharedMemory::post_run_hook()
+{
+  // Spikes of the last time slice are delivered after the last call to
+  // post_step_hook().
+  for ( auto& buffer : buffers_ )
+  {
+    write_buffer_( buffer );
+  }
+}
+
+void
+nest::RecordingBackendSharedMemory::post_step_hook()
+{
+  write_buffer_( buffers_[ kernel().vp_manager.get_thread_id() ] );
+}
+
+void
+nest::RecordingBackendSharedMemory::write_buffer_( ThreadBuffer& buffer )
+{
+  if ( buffer.records.empty() )
+  {
+    return;
+  }
+  if ( not data_ )
+  {
+    // devices enrolled after the last call to Prepare record nothing
+    buffer.records.clear();
+    buffer.double_values.clear();
+    buffer.long_values.clear();
+    return;
+  }
+
+  const uint64_t first = header_->write_sequence.fetch_add( buffer.records.size(), std::memory_order_acq_rel );
+  const double* double_values = buffer.double_values.data();
+  const long* long_values = buffer.long_values.data();
+  for ( size_t i = 0; i < buffer.records.size(); ++i )
+  {
+    const uint64_t number = first + i;
+    char* slot = data_ + shared_memory_stream_data_offset + ( number % header_->capacity ) * header_->slot_size;
+    SharedMemoryStreamRecord* record = reinterpret_cast< SharedMemoryStreamRecord* >( slot );
+
+    record->sequence.store( 0, std::memory_order_relaxed );
+    std::atomic_thread_fence( std::memory_order_release );
+
+    const PendingRecord& pending = buffer.records[ i ];
+    record->device = pending.device;
+    record->sender = pending.sender;
+    record->time_step = pending.time_step;
+    record->offset = pending.offset;
+    record->n_double_values = pending.n_double_values;
+    record->n_long_values = pending.n_long_values;
+
+    char* values = slot + sizeof( SharedMemoryStreamRecord );
+    std::memcpy( values, double_values, pending.n_double_values * sizeof( double ) );
+    values += pending.n_double_values * sizeof( double );
+    for ( size_t j = 0; j < pending.n_long_values; ++j )
+    {
+      const int64_t value = long_values[ j ];
+      std::memcpy( values + j * sizeof( int64_t ), &value, sizeof( int64_t ) );
+    }
+    double_values += pending.n_double_values;
+    long_values += pending.n_long_values;
+
+    record->sequence.store( number + 1, std::memory_order_release );
+  }
+
+  buffer.records.clear();
+  buffer.double_values.clear();
+  buffer.long_values.clear();
+}
+
+void
+nest::RecordingBackendSharedMemory::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const thread t = device.get_thread();
+  if ( devices_[ t ].find( device.get_node_id() ) == devices_[ t ].end() )
+  {
+    return;
+  }
+
+  ThreadBuffer& buffer = buffers_[ t ];
+  buffer.records.push_back( { device.get_node_id(),
+    event.get_sender_node_id(),
+    event.get_stamp().get_steps(),
+    event.get_offset(),
+    double_values.size(),
+    long_values.size() } );
+  buffer.double_values.insert( buffer.double_values.end(), double_values.begin(), double_values.end() );
+  buffer.long_values.insert( buffer.long_values.end(), long_values.begin(), long_values.end() );
+}
+
+void
+nest::RecordingBackendSharedMemory::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  if ( data_
+    and ( ptmp.segment_name_ != P_.segment_name_ or ptmp.capacity_ != P_.capacity_
+          or ptmp.max_values_ != P_.max_values_ ) )
+  {
+    throw BadProperty( "The properties of the shared_memory backend cannot be changed once the segment exists." );
+  }
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+void
+nest::RecordingBackendSharedMemory::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+}
+
+void
+nest::RecordingBackendSharedMemory::check_device_status( const DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSharedMemory::get_device_defaults( DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendSharedMemory::get_device_status( const nest::RecordingDevice&, DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+/* ******************* Backend parameters ******************* */
+
+nest::RecordingBackendSharedMemory::Parameters_::Parameters_()
+  : segment_name_( "/nest_recording" )
+  , capacity_( 1 << 16 )
+  , max_values_( 8 )
+{
+}
+
+void
+nest::RecordingBackendSharedMemory::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::segment_name ] = segment_name_;
+  ( *d )[ names::capacity ] = capacity_;
+  ( *d )[ names::max_values ] = max_values_;
+}
+
+void
+nest::RecordingBackendSharedMemory::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::segment_name, segment_name_ );
+  updateValue< long >( d, names::capacity, capacity_ );
+  updateValue< long >( d, names::max_values, max_values_ );
+
+  if ( segment_name_.size() < 2 or segment_name_[ 0 ] != '/' or segment_name_.find( '/', 1 ) != std::string::npos )
+  {
+    throw BadProperty( "segment_name must start with '/' and must not contain further '/'." );
+  }
+  if ( capacity_ < 1 )
+  {
+    throw BadProperty( "capacity > 0 required." );
+  }
+  if ( max_values_ < 0 )
+  {
+    throw BadProperty( "max_values >= 0 required." );
+  }
+}
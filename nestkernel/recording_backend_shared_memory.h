@@ -0,0 +1,229 @@
+/*
+ *  recording_backend_shared_memory.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_SHARED_MEMORY_H
+#define RECORDING_BACKEND_SHARED_MEMORY_H
+
+// C++ includes:
+#include <set>
+
+#include "recording_backend.h"
+#include "shared_memory_stream.h"
+
+/* BeginUserDocs: recording backend
+
+.. _shared_memory_backend:
+
+Stream data to other processes through shared memory
+####################################################
+
+The `shared_memory` recording backend publishes collected data in a
+POSIX shared-memory segment, from which other processes on the same
+machine can read it while the simulation runs. It is intended for online
+monitoring and analysis, where writing and parsing files would be too
+slow.
+
+The backend creates one segment per MPI process, which is shared by all
+recording devices recording to it. The name of the segment is the
+backend property ``segment_name`` followed by an underscore and the rank
+of the MPI process, e.g. ``/nest_recording_0``. The segment is created by
+the first call to ``Prepare`` after a device has been set to record to
+this backend and is removed by ``ResetKernel`` or at the end of the
+simulation script. Consumers that have mapped the segment can continue to
+read it after it has been removed.
+
+Data format
++++++++++++
+
+The segment is a ring buffer of ``capacity`` records, preceded by a
+header that describes the size of the records. Each record holds the
+node ID of the recording device, the node ID of the sender, the time of
+the event as time step and offset, the recorded floating point values
+and the recorded integer values. Records are numbered in the order in
+which they are written, and sequence counters in the header and in each
+record allow consumers to detect records that have been overwritten
+before they were read. The writing threads never wait for consumers.
+The exact layout and the protocol for reading are documented in
+``shared_memory_stream.h``, which is installed with the NEST headers and
+can be included by consumers without linking to NEST.
+
+The records collected by each thread during a time slice are written to
+the segment at the end of the time slice, so consumers see data with a
+delay of at most one time slice. The ring buffer has to hold at least
+the records written during one time slice.
+
+NEST ships with the tool ``nest_shm_reader``, which prints the records
+of a segment as text. It is started as
+
+::
+
+   nest_shm_reader [-f] [-o output_file] segment_name
+
+and prints all records currently held by the segment. With ``-f``, it
+keeps waiting for new records until it is interrupted.
+
+Parameter summary
++++++++++++++++++
+
+The following properties of the backend are set in the dictionary
+``recording_backends`` of the kernel status, e.g.
+``SetKernelStatus({"recording_backends": {"shared_memory":
+{"capacity": 1048576}}})``. They cannot be changed once the segment has
+been created.
+
+.. glossary::
+
+ segment_name
+   A string (default: *"/nest_recording"*) that determines the name of
+   the segment.
+
+ capacity
+   An integer (default: *65536*) that specifies the number of records
+   the segment holds.
+
+ max_values
+   An integer (default: *8*) that specifies the maximal number of values
+   a record can hold. Devices recording more values cannot record to
+   this backend.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Shared-memory specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendSharedMemory collects the records of each thread in a
+ * buffer in write() and copies them to a ring buffer in a POSIX
+ * shared-memory segment in post_step_hook(). The threads reserve their
+ * slots in the ring buffer with a single atomic increment, so they never
+ * wait for each other or for consumers.
+ */
+class RecordingBackendSharedMemory : public RecordingBackend
+{
+public:
+  RecordingBackendSharedMemory();
+
+  ~RecordingBackendSharedMemory() throw();
+
+  void initialize() override;
+
+  /**
+   * Unmap and remove the segment
+   */
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  /**
+   * Create the segment if devices record to this backend
+   */
+  void prepare() override;
+
+  void cleanup() override;
+
+  void pre_run_hook() override;
+
+  /**
+   * Copy the records collected by all threads to the segment
+   */
+  void post_run_hook() override;
+
+  /**
+   * Copy the records collected by the calling thread to the segment
+   */
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  void create_segment_();
+
+  /**
+   * A record collected by a thread, whose values are stored in the
+   * value buffers of the thread.
+   */
+  struct PendingRecord
+  {
+    index device;
+    index sender;
+    long time_step;
+    double offset;
+    size_t n_double_values;
+    size_t n_long_values;
+  };
+
+  /**
+   * Records of one thread that have not yet been written to the segment.
+   * The buffers are cleared, but not freed after writing, so they do not
+   * allocate memory once they have grown to the size of a time slice.
+   */
+  struct ThreadBuffer
+  {
+    std::vector< PendingRecord > records;
+    std::vector< double > double_values;
+    std::vector< long > long_values;
+  };
+
+  //! Copy the records of the buffer to the segment and clear the buffer
+  void write_buffer_( ThreadBuffer& buffer );
+
+  std::vector< std::set< index > > devices_; //!< enrolled devices per thread
+  std::vector< ThreadBuffer > buffers_;      //!< pending records per thread
+
+  struct Parameters_
+  {
+    std::string segment_name_; //!< Prefix of the name of the segment
+    long capacity_;            //!< Number of records in the ring buffer
+    long max_values_;          //!< Maximal number of values per record
+
+    Parameters_();
+
+    void get( DictionaryDatum& ) const;
+    void set( const DictionaryDatum& );
+  };
+
+  Parameters_ P_;
+
+  std::string segment_;              //!< Name of the segment, empty if no segment exists
+  char* data_;                       //!< Mapping of the segment
+  size_t size_;                      //!< Size of the segment in bytes
+  SharedMemoryStreamHeader* header_; //!< Header at the start of the segment
+};
+
+} // namespace
+
+#endif // RECORDING_BACKEND_SHARED_MEMORY_H
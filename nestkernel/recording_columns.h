@@ -0,0 +1,72 @@
+/*
+ *  recording_columns.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_COLUMNS_H
+#define RECORDING_COLUMNS_H
+
+// C++ includes:
+#include <string>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Events recorded by a recording device, stored column-wise in contiguous
+ * arrays.
+ *
+ * Entry i of all columns describes the same event. RecordingColumns is
+ * filled by RecordingBackend::get_device_columns() and allows to retrieve
+ * the recorded events without creating an SLI array for every quantity.
+ * Depending on time_in_steps, either times or time_steps and offsets are
+ * filled, the other columns are empty.
+ */
+struct RecordingColumns
+{
+  std::vector< long > senders;
+  std::vector< double > times;    //!< Times of the events in ms
+  std::vector< long > time_steps; //!< Times of the events in steps
+  std::vector< double > offsets;  //!< Offsets of the events in ms
+
+  std::vector< std::string > double_value_names;
+  std::vector< std::vector< double > > double_values; //!< One column per value of type double
+  std::vector< std::string > long_value_names;
+  std::vector< std::vector< long > > long_values; //!< One column per value of type long
+
+  //! Whether times are given in steps and offsets
+  bool time_in_steps;
+
+  RecordingColumns()
+    : time_in_steps( false )
+  {
+  }
+
+  size_t
+  size() const
+  {
+    return senders.size();
+  }
+};
+
+} // namespace nest
+
+#endif /* RECORDING_COLUMNS_H */
@@ -206,6 +206,12 @@ nest::RecordingDevice::get_status( DictionaryDatum& d ) const
   }
 }
 
+void
+nest::RecordingDevice::get_columns( const bool drain, RecordingColumns& columns ) const
+{
+  kernel().io_manager.get_recording_backend_device_columns( P_.record_to_, *this, drain, columns );
+}
+
 bool
 nest::RecordingDevice::is_active( Time const& T ) const
 {
@@ -222,3 +228,15 @@ nest::RecordingDevice::write( const Event& event,
   kernel().io_manager.write( P_.record_to_, *this, event, double_values, long_values );
   S_.n_events_++;
 }
+
+void
+nest::RecordingDevice::write_spikes( const std::vector< RecordedSpike >& spikes )
+{
+  kernel().io_manager.write_spikes( P_.record_to_, *this, spikes );
+  S_.n_events_ += spikes.size();
+}
+
+void
+nest::RecordingDevice::write_buffered_records()
+{
+}
@@ -99,8 +99,27 @@ public:
   void set_status( const DictionaryDatum& ) override;
   void get_status( DictionaryDatum& ) const override;
 
+  /**
+   * Append the events stored by the recording backend for this device to
+   * columns and remove them from the backend if drain is true.
+   */
+  void get_columns( const bool drain, RecordingColumns& columns ) const;
+
+  /**
+   * Write the records collected during the current time slice to the
+   * recording backend.
+   *
+   * This is called by IOManager::post_step_hook() for devices that have
+   * registered with IOManager::register_buffering_recorder(). The default
+   * implementation does nothing.
+   */
+  virtual void write_buffered_records();
+
 protected:
   void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+
+  //! Write the given spikes to the recording backend in a single call
+  void write_spikes( const std::vector< RecordedSpike >& );
   void set_initialized_() override;
 
 private:
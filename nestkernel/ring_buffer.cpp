@@ -22,6 +22,9 @@
 
 #include "ring_buffer.h"
 
+// Includes from nestkernel:
+#include "checkpoint.h"
+
 nest::RingBuffer::RingBuffer()
   : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(), 0.0 )
 {
@@ -45,6 +48,25 @@ nest::RingBuffer::clear()
   buffer_.assign( buffer_.size(), 0.0 );
 }
 
+void
+nest::RingBuffer::write_checkpoint( std::ostream& os ) const
+{
+  write_checkpoint_vector( os, buffer_ );
+}
+
+void
+nest::RingBuffer::read_checkpoint( std::istream& is )
+{
+  read_checkpoint_vector( is, buffer_ );
+}
+
+
+size_t
+nest::RingBuffer::get_memory_forecast()
+{
+  return ( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay() )
+    * sizeof( double );
+}
 
 nest::MultRBuffer::MultRBuffer()
   : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(), 0.0 )
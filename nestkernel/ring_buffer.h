@@ -24,6 +24,7 @@
 #define RING_BUFFER_H
 
 // C++ includes:
+#include <iosfwd>
 #include <list>
 #include <vector>
 
@@ -124,6 +125,16 @@ public:
    */
   void resize();
 
+  /**
+   * Write the buffer contents to a checkpoint.
+   */
+  void write_checkpoint( std::ostream& ) const;
+
+  /**
+   * Replace the buffer contents by those read from a checkpoint.
+   */
+  void read_checkpoint( std::istream& );
+
   /**
    * Returns buffer size, for memory measurement.
    */
@@ -133,6 +144,12 @@ public:
     return buffer_.size();
   }
 
+  /**
+   * Returns the number of bytes a ring buffer allocates when the
+   * simulation is prepared, given the current delay extrema.
+   */
+  static size_t get_memory_forecast();
+
 private:
   //! Buffered data
   std::vector< double > buffer_;
@@ -24,6 +24,7 @@
 
 // C++ includes:
 #include <set>
+#include <sstream>
 
 // Includes from libnestutil:
 #include "logging.h"
@@ -33,6 +34,7 @@
 #include "random_datums.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "vp_manager_impl.h"
@@ -263,3 +265,48 @@ nest::RNGManager::create_grng_()
   grng_seed_ = s;
   grng_->seed( s );
 }
+
+void
+nest::RNGManager::write_checkpoint( std::ostream& os ) const
+{
+  write_rng_state_( os, grng_ );
+  for ( size_t t = 0; t < rng_.size(); ++t )
+  {
+    write_rng_state_( os, rng_[ t ] );
+  }
+}
+
+void
+nest::RNGManager::read_checkpoint( std::istream& is )
+{
+  read_rng_state_( is, grng_ );
+  for ( size_t t = 0; t < rng_.size(); ++t )
+  {
+    read_rng_state_( is, rng_[ t ] );
+  }
+}
+
+void
+nest::RNGManager::write_rng_state_( std::ostream& os, const librandom::RngPtr& rng ) const
+{
+  // states are written with their size, so that restoring fails cleanly
+  // if the generators are of different type
+  std::ostringstream state;
+  rng->write_state( state );
+  write_checkpoint_string( os, state.str() );
+}
+
+void
+nest::RNGManager::read_rng_state_( std::istream& is, librandom::RngPtr& rng )
+{
+  std::string data;
+  read_checkpoint_string( is, data );
+
+  std::istringstream state( data );
+  rng->read_state( state );
+  if ( not state or state.peek() != std::char_traits< char >::eof() )
+  {
+    throw KernelException(
+      "The random number generators of the checkpoint do not match the random number generators of the kernel." );
+  }
+}
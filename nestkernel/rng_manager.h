@@ -24,6 +24,7 @@
 #define RNG_MANAGER_H
 
 // C++ includes:
+#include <iosfwd>
 #include <vector>
 
 // Includes from libnestutil:
@@ -70,10 +71,26 @@ public:
    */
   librandom::RngPtr get_grng() const;
 
+  /**
+   * Write the states of the global and all thread-local random number
+   * generators to a checkpoint.
+   * @see write_checkpoint()
+   */
+  void write_checkpoint( std::ostream& ) const;
+
+  /**
+   * Restore the states of all random number generators from a checkpoint.
+   * @see read_checkpoint()
+   */
+  void read_checkpoint( std::istream& );
+
 private:
   void create_rngs_();
   void create_grng_();
 
+  void write_rng_state_( std::ostream&, const librandom::RngPtr& ) const;
+  void read_rng_state_( std::istream&, librandom::RngPtr& );
+
   /**
    * Vector of random number generators for threads.
    * There must be PRECISELY one rng per thread.
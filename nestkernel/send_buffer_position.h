@@ -47,6 +47,7 @@ private:
   thread max_size_;
   size_t num_spike_data_written_;
   size_t send_recv_count_per_rank_;
+  size_t num_header_entries_;
   std::vector< thread > idx_;
   std::vector< thread > begin_;
   std::vector< thread > end_;
@@ -54,7 +55,13 @@ private:
   thread rank_to_index_( const thread rank ) const;
 
 public:
-  SendBufferPosition( const AssignedRanks& assigned_ranks, const unsigned int send_recv_count_per_rank );
+  /**
+   * The first num_header_entries entries of every chunk are reserved
+   * and not available for writing via idx() and increase().
+   */
+  SendBufferPosition( const AssignedRanks& assigned_ranks,
+    const unsigned int send_recv_count_per_rank,
+    const unsigned int num_header_entries = 0 );
 
   /**
    * Returns current index of specified rank in MPI buffer.
@@ -89,13 +96,15 @@ public:
 };
 
 inline SendBufferPosition::SendBufferPosition( const AssignedRanks& assigned_ranks,
-  const unsigned int send_recv_count_per_rank )
+  const unsigned int send_recv_count_per_rank,
+  const unsigned int num_header_entries )
   : begin_rank_( assigned_ranks.begin )
   , end_rank_( assigned_ranks.end )
   , size_( assigned_ranks.size )
   , max_size_( assigned_ranks.max_size )
   , num_spike_data_written_( 0 )
   , send_recv_count_per_rank_( send_recv_count_per_rank )
+  , num_header_entries_( num_header_entries )
 {
   idx_.resize( assigned_ranks.size );
   begin_.resize( assigned_ranks.size );
@@ -105,7 +114,7 @@ inline SendBufferPosition::SendBufferPosition( const AssignedRanks& assigned_ran
     // thread-local index of (global) rank
     const thread lr_idx = rank % assigned_ranks.max_size;
     assert( lr_idx < assigned_ranks.size );
-    idx_[ lr_idx ] = rank * send_recv_count_per_rank;
+    idx_[ lr_idx ] = rank * send_recv_count_per_rank + num_header_entries;
     begin_[ lr_idx ] = rank * send_recv_count_per_rank;
     end_[ lr_idx ] = ( rank + 1 ) * send_recv_count_per_rank;
   }
@@ -146,7 +155,7 @@ SendBufferPosition::is_chunk_filled( const thread rank ) const
 inline bool
 SendBufferPosition::are_all_chunks_filled() const
 {
-  return num_spike_data_written_ == send_recv_count_per_rank_ * idx_.size();
+  return num_spike_data_written_ == ( send_recv_count_per_rank_ - num_header_entries_ ) * idx_.size();
 }
 
 inline void
@@ -0,0 +1,100 @@
+/*
+ *  shared_memory_stream.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SHARED_MEMORY_STREAM_H
+#define SHARED_MEMORY_STREAM_H
+
+// C++ includes:
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nest
+{
+
+/**
+ * Layout of the shared-memory segments written by the shared_memory
+ * recording backend.
+ *
+ * This header is self-contained, so that consumer processes can include
+ * it without linking to NEST. A segment consists of a SharedMemoryStreamHeader
+ * followed by SharedMemoryStreamHeader::capacity record slots of
+ * SharedMemoryStreamHeader::slot_size bytes each. Record number n is stored
+ * in slot n % capacity. Each slot starts with a SharedMemoryStreamRecord,
+ * which is followed by the double values and then the long values of the
+ * record, each stored in 8 bytes.
+ *
+ * Several writers reserve consecutive record numbers by incrementing
+ * write_sequence and then fill their slots. While a slot is written, its
+ * sequence is 0; afterwards it is the record number plus one. A consumer
+ * that wants to read record n thus
+ *
+ * 1. skips to record write_sequence - capacity if n is smaller, as the
+ *    records before have been overwritten,
+ * 2. stops if sequence is smaller than n + 1, as the record has not been
+ *    written yet,
+ * 3. copies the record and checks that sequence is still n + 1 afterwards;
+ *    otherwise, the record has been overwritten while it was copied.
+ *
+ * Writers never wait for consumers.
+ */
+struct SharedMemoryStreamHeader
+{
+  char magic[ 8 ];     //!< "NESTSHM1"
+  uint64_t capacity;   //!< number of record slots
+  uint64_t slot_size;  //!< size of a record slot in bytes
+  uint64_t max_values; //!< maximal number of values per record
+  double resolution;   //!< simulation resolution in ms
+
+  //! number of records reserved by writers since the segment was created
+  std::atomic< uint64_t > write_sequence;
+};
+
+/**
+ * Fixed part of a record slot in a shared-memory segment.
+ */
+struct SharedMemoryStreamRecord
+{
+  std::atomic< uint64_t > sequence; //!< record number plus one, 0 while the slot is written
+  uint64_t device;                  //!< node ID of the recording device
+  uint64_t sender;                  //!< node ID of the sender of the event
+  int64_t time_step;                //!< time of the event in steps
+  double offset;                    //!< offset of the event from the time step in ms
+  uint32_t n_double_values;         //!< number of double values following the record
+  uint32_t n_long_values;           //!< number of long values following the double values
+};
+
+const char shared_memory_stream_magic[ 8 ] = { 'N', 'E', 'S', 'T', 'S', 'H', 'M', '1' };
+
+//! Offset of the first record slot from the start of a segment
+const size_t shared_memory_stream_data_offset = ( sizeof( SharedMemoryStreamHeader ) + 63 ) / 64 * 64;
+
+//! Size of a record slot that can hold the given number of values
+inline size_t
+shared_memory_stream_slot_size( size_t max_values )
+{
+  return sizeof( SharedMemoryStreamRecord ) + max_values * sizeof( uint64_t );
+}
+
+} // namespace nest
+
+#endif /* #ifndef SHARED_MEMORY_STREAM_H */
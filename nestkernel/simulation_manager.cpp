@@ -33,6 +33,7 @@
 #include "numerics.h"
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "connection_manager_impl.h"
 #include "event_delivery_manager.h"
 #include "kernel_manager.h"
@@ -40,6 +41,23 @@
 // Includes from sli:
 #include "dictutils.h"
 
+#ifdef TIMER_DETAILED
+namespace
+{
+std::vector< double >
+elapsed_per_thread( const std::vector< nest::Stopwatch >& stopwatches )
+{
+  std::vector< double > elapsed;
+  elapsed.reserve( stopwatches.size() );
+  for ( const auto& sw : stopwatches )
+  {
+    elapsed.push_back( sw.elapsed() );
+  }
+  return elapsed;
+}
+}
+#endif
+
 nest::SimulationManager::SimulationManager()
   : clock_( Time::tic( 0L ) )
   , slice_( 0L )
@@ -52,6 +70,7 @@ nest::SimulationManager::SimulationManager()
   , simulated_( false )
   , inconsistent_state_( false )
   , print_time_( false )
+  , population_update_( false )
   , use_wfr_( true )
   , wfr_comm_interval_( 1.0 )
   , wfr_tol_( 0.0001 )
@@ -71,6 +90,8 @@ nest::SimulationManager::initialize()
   simulating_ = false;
   simulated_ = false;
   inconsistent_state_ = false;
+
+  reset_timers_();
 }
 
 void
@@ -85,6 +106,24 @@ nest::SimulationManager::finalize()
   to_step_ = 0; // consistent with to_do_ = 0
 }
 
+void
+nest::SimulationManager::change_num_threads( thread )
+{
+  reset_timers_();
+}
+
+void
+nest::SimulationManager::reset_timers_()
+{
+#ifdef TIMER_DETAILED
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  sw_update_.assign( num_threads, Stopwatch() );
+  sw_wfr_update_.assign( num_threads, Stopwatch() );
+  sw_post_step_hook_.assign( num_threads, Stopwatch() );
+  sw_omp_synchronization_.assign( num_threads, Stopwatch() );
+#endif
+}
+
 void
 nest::SimulationManager::set_status( const DictionaryDatum& d )
 {
@@ -125,6 +164,7 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
   }
 
   updateValue< bool >( d, names::print_time, print_time_ );
+  updateValue< bool >( d, names::population_update, population_update_ );
 
   // tics_per_ms and resolution must come after local_num_thread /
   // total_num_threads because they might reset the network and the time
@@ -382,12 +422,20 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::time, get_time().get_ms() );
   def< long >( d, names::to_do, to_do_ );
   def< bool >( d, names::print_time, print_time_ );
+  def< bool >( d, names::population_update, population_update_ );
 
   def< bool >( d, names::use_wfr, use_wfr_ );
   def< double >( d, names::wfr_comm_interval, wfr_comm_interval_ );
   def< double >( d, names::wfr_tol, wfr_tol_ );
   def< long >( d, names::wfr_max_iterations, wfr_max_iterations_ );
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
+
+#ifdef TIMER_DETAILED
+  def< std::vector< double > >( d, names::time_update, elapsed_per_thread( sw_update_ ) );
+  def< std::vector< double > >( d, names::time_wfr_update, elapsed_per_thread( sw_wfr_update_ ) );
+  def< std::vector< double > >( d, names::time_post_step_hook, elapsed_per_thread( sw_post_step_hook_ ) );
+  def< std::vector< double > >( d, names::time_omp_synchronization, elapsed_per_thread( sw_omp_synchronization_ ) );
+#endif
 }
 
 void
@@ -409,6 +457,11 @@ nest::SimulationManager::prepare()
       "earlier error. Please run ResetKernel first." );
   }
 
+  if ( kernel().mpi_manager.is_dryrun_mode() )
+  {
+    throw KernelException( "Simulation is not possible after SetFakeNumProcesses." );
+  }
+
   t_real_ = 0;
   t_slice_begin_ = timeval(); // set to timeval{0, 0} as unset flag
   t_slice_end_ = timeval();   // set to timeval{0, 0} as unset flag
@@ -418,6 +471,33 @@ nest::SimulationManager::prepare()
   kernel().connection_manager.update_delay_extrema_();
   kernel().event_delivery_manager.init_moduli();
 
+  // With pipelined spike exchange, spikes are delivered one slice late,
+  // which is only correct if they are not due before the next slice.
+  if ( kernel().event_delivery_manager.get_pipelined_spike_exchange() )
+  {
+    if ( kernel().sp_manager.is_structural_plasticity_enabled() )
+    {
+      LOG( M_ERROR,
+        "SimulationManager::prepare",
+        "Pipelined spike exchange cannot be combined with structural plasticity." );
+      throw KernelException();
+    }
+
+    const delay min_delay = kernel().connection_manager.get_min_delay();
+    const delay shortest_delay = kernel().connection_manager.get_shortest_delay();
+    if ( shortest_delay < 2 * min_delay )
+    {
+      std::string msg = String::compose(
+        "Pipelined spike exchange requires all delays to be at least twice "
+        "min_delay, but the shortest delay is %1 ms and min_delay is %2 ms. "
+        "Please set min_delay and max_delay explicitly.",
+        Time::delay_steps_to_ms( shortest_delay ),
+        Time::delay_steps_to_ms( min_delay ) );
+      LOG( M_ERROR, "SimulationManager::prepare", msg );
+      throw KernelException();
+    }
+  }
+
   // Check for synchrony of global rngs over processes.
   // We need to do this ahead of any simulation in case random numbers
   // have been consumed on the SLI level.
@@ -534,6 +614,7 @@ nest::SimulationManager::run( Time const& t )
 
   // Reset profiling timers and counters within event_delivery_manager
   kernel().event_delivery_manager.reset_timers_counters();
+  reset_timers_();
 
   // from_step_ is not touched here.  If we are at the beginning
   // of a simulation, it has been reset properly elsewhere.  If
@@ -568,6 +649,7 @@ nest::SimulationManager::run( Time const& t )
 
   call_update_();
 
+  kernel().node_manager.post_run_cleanup();
   kernel().io_manager.post_run_hook();
 }
 
@@ -708,6 +790,27 @@ nest::SimulationManager::update_connection_infrastructure( const thread tid )
   kernel().connection_manager.unset_have_connections_changed( tid );
 }
 
+void
+nest::SimulationManager::write_checkpoint( std::ostream& os ) const
+{
+  write_checkpoint_value( os, clock_.get_tics() );
+  write_checkpoint_value( os, slice_ );
+  write_checkpoint_value( os, from_step_ );
+  write_checkpoint_value( os, to_step_ );
+}
+
+void
+nest::SimulationManager::read_checkpoint( std::istream& is )
+{
+  tic_t clock;
+  read_checkpoint_value( is, clock );
+  read_checkpoint_value( is, slice_ );
+  read_checkpoint_value( is, from_step_ );
+  read_checkpoint_value( is, to_step_ );
+  clock_ = Time::tic( clock );
+  to_do_ = 0;
+}
+
 bool
 nest::SimulationManager::wfr_update_( Node* n )
 {
@@ -728,6 +831,13 @@ nest::SimulationManager::update_()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
 
+    // Nodes handed over to population engines are skipped in the update
+    // loop below and updated by their engine instead.
+    if ( population_update_ )
+    {
+      kernel().node_manager.create_population_engines( tid );
+    }
+
     do
     {
       if ( print_time_ )
@@ -819,6 +929,9 @@ nest::SimulationManager::update_()
           }
         }
 
+#ifdef TIMER_DETAILED
+        sw_wfr_update_[ tid ].start();
+#endif
         bool max_iterations_reached = true;
         const std::vector< Node* >& thread_local_wfr_nodes = kernel().node_manager.get_wfr_nodes_on_thread( tid );
         for ( long n = 0; n < wfr_max_iterations_; ++n )
@@ -869,6 +982,9 @@ nest::SimulationManager::update_()
             break;
           }
         } // of for (wfr_max_iterations) ...
+#ifdef TIMER_DETAILED
+        sw_wfr_update_[ tid ].stop();
+#endif
 
 #pragma omp single
         {
@@ -885,6 +1001,26 @@ nest::SimulationManager::update_()
       } // of if(wfr_is_used)
       // end of preliminary update
 
+#ifdef TIMER_DETAILED
+      sw_update_[ tid ].start();
+#endif
+      const std::vector< PopulationEngine* >& thread_local_engines =
+        kernel().node_manager.get_population_engines( tid );
+      for ( std::vector< PopulationEngine* >::const_iterator it = thread_local_engines.begin();
+            it != thread_local_engines.end();
+            ++it )
+      {
+        try
+        {
+          ( *it )->update( clock_, from_step_, to_step_ );
+        }
+        catch ( std::exception& e )
+        {
+          // so throw the exception after parallel region
+          exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
+        }
+      }
+
       const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
       for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
       {
@@ -893,7 +1029,7 @@ nest::SimulationManager::update_()
         try
         {
           Node* node = n->get_node();
-          if ( not( node )->is_frozen() )
+          if ( not( node )->is_frozen() and not( node )->is_in_population() )
           {
             ( node )->update( clock_, from_step_, to_step_ );
           }
@@ -904,9 +1040,16 @@ nest::SimulationManager::update_()
           exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( e ) );
         }
       }
+#ifdef TIMER_DETAILED
+      sw_update_[ tid ].stop();
+      sw_omp_synchronization_[ tid ].start();
+#endif
 
 // parallel section ends, wait until all threads are done -> synchronize
 #pragma omp barrier
+#ifdef TIMER_DETAILED
+      sw_omp_synchronization_[ tid ].stop();
+#endif
       // gather and deliver only at end of slice, i.e., end of min_delay step
       if ( to_step_ == kernel().connection_manager.get_min_delay() )
       {
@@ -924,7 +1067,13 @@ nest::SimulationManager::update_()
         }
       }
 
+#ifdef TIMER_DETAILED
+      sw_omp_synchronization_[ tid ].start();
+#endif
 #pragma omp barrier
+#ifdef TIMER_DETAILED
+      sw_omp_synchronization_[ tid ].stop();
+#endif
 
 // the following block is executed by the master thread only
 // the other threads are enforced to wait at the end of the block
@@ -940,11 +1089,33 @@ nest::SimulationManager::update_()
       }
 // end of master section, all threads have to synchronize at this point
 #pragma omp barrier
+#ifdef TIMER_DETAILED
+      sw_post_step_hook_[ tid ].start();
+#endif
       kernel().io_manager.post_step_hook();
+#ifdef TIMER_DETAILED
+      sw_post_step_hook_[ tid ].stop();
+      sw_omp_synchronization_[ tid ].start();
+#endif
 // enforce synchronization after post-step activities of the recording backends
 #pragma omp barrier
+#ifdef TIMER_DETAILED
+      sw_omp_synchronization_[ tid ].stop();
+#endif
     } while ( to_do_ > 0 and not exceptions_raised.at( tid ) );
 
+    // Deliver spikes of the last completed slice, so that no exchange
+    // is pending between calls to simulate.
+    if ( kernel().connection_manager.has_primary_connections() )
+    {
+      kernel().event_delivery_manager.complete_pending_spike_data( tid );
+    }
+
+    if ( population_update_ )
+    {
+      kernel().node_manager.release_population_engines( tid );
+    }
+
     // End of the slice, we update the number of synaptic elements
     for ( SparseNodeArray::const_iterator i = kernel().node_manager.get_local_nodes( tid ).begin();
           i != kernel().node_manager.get_local_nodes( tid ).end();
@@ -27,10 +27,12 @@
 #include <sys/time.h>
 
 // C++ includes:
+#include <iosfwd>
 #include <vector>
 
 // Includes from libnestutil:
 #include "manager_interface.h"
+#include "stopwatch.h"
 
 // Includes from nestkernel:
 #include "nest_time.h"
@@ -50,6 +52,7 @@ public:
 
   virtual void initialize();
   virtual void finalize();
+  virtual void change_num_threads( thread );
 
   virtual void set_status( const DictionaryDatum& );
   virtual void get_status( DictionaryDatum& );
@@ -156,12 +159,25 @@ public:
   //! Sorts source table and connections and create new target table.
   void update_connection_infrastructure( const thread tid );
 
+  /**
+   * Write the simulation clock to a checkpoint.
+   * @see write_checkpoint()
+   */
+  void write_checkpoint( std::ostream& ) const;
+
+  /**
+   * Restore the simulation clock from a checkpoint.
+   * @see read_checkpoint()
+   */
+  void read_checkpoint( std::istream& );
+
 private:
   void call_update_(); //!< actually run simulation, aka wrap update_
   void update_();      //! actually perform simulation
   bool wfr_update_( Node* );
   void advance_time_();   //!< Update time to next time step
   void print_progress_(); //!< TODO: Remove, replace by logging!
+  void reset_timers_();   //!< Set per-thread phase timers to zero
 
   Time clock_;                     //!< SimulationManager clock, updated once per slice
   delay slice_;                    //!< current update slice
@@ -181,6 +197,8 @@ private:
                                    //!< simulation must not be resumed
   bool print_time_;                //!< Indicates whether time should be printed during
                                    //!< simulations (or not)
+  bool population_update_;         //!< Update neurons by PopulationEngines
+                                   //!< where models provide them
   bool use_wfr_;                   //!< Indicates wheter waveform relaxation is used
   double wfr_comm_interval_;       //!< Desired waveform relaxation communication
                                    //!< interval (in ms)
@@ -189,6 +207,15 @@ private:
                                    //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+
+#ifdef TIMER_DETAILED
+  // Per-thread timers for the phases of update_(), accumulated over a
+  // call to run(); each thread only touches its own entry.
+  std::vector< Stopwatch > sw_update_;              //!< time spent in Node::update()
+  std::vector< Stopwatch > sw_wfr_update_;          //!< time spent in waveform relaxation iterations
+  std::vector< Stopwatch > sw_post_step_hook_;      //!< time spent in IOManager::post_step_hook()
+  std::vector< Stopwatch > sw_omp_synchronization_; //!< time spent waiting at barriers
+#endif
 };
 
 inline Time const&
@@ -24,9 +24,11 @@
 #include <iostream>
 
 // Includes from nestkernel:
+#include "checkpoint.h"
 #include "connection_manager.h"
 #include "connection_manager_impl.h"
 #include "kernel_manager.h"
+#include "memory_status.h"
 #include "mpi_manager_impl.h"
 #include "source_table.h"
 #include "vp_manager_impl.h"
@@ -149,6 +151,18 @@ nest::SourceTable::clean( const thread tid )
 void
 nest::SourceTable::reserve( const thread tid, const synindex syn_id, const size_t count )
 {
+  sources_[ tid ][ syn_id ].reserve( sources_[ tid ][ syn_id ].size() + count );
+}
+
+size_t
+nest::SourceTable::get_memory_usage( const thread tid, const synindex syn_id ) const
+{
+  // The sources of a thread are removed entirely once the table is cleared.
+  if ( syn_id >= sources_[ tid ].size() )
+  {
+    return 0;
+  }
+  return allocated_bytes( sources_[ tid ][ syn_id ] );
 }
 
 nest::index
@@ -265,6 +279,33 @@ nest::SourceTable::resize_sources( const thread tid )
   sources_[ tid ].resize( kernel().model_manager.get_num_synapse_prototypes() );
 }
 
+void
+nest::SourceTable::write_checkpoint( const thread tid, const synindex syn_id, std::ostream& os ) const
+{
+  const BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  write_checkpoint_value( os, sources.size() );
+  for ( BlockVector< Source >::const_iterator it = sources.begin(); it != sources.end(); ++it )
+  {
+    write_checkpoint_value( os, *it );
+  }
+}
+
+void
+nest::SourceTable::read_checkpoint( const thread tid, const synindex syn_id, std::istream& is )
+{
+  BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  sources.clear();
+
+  size_t num_sources;
+  read_checkpoint_value( is, num_sources );
+  for ( size_t i = 0; i < num_sources; ++i )
+  {
+    Source source;
+    read_checkpoint_value( is, source );
+    sources.push_back( source );
+  }
+}
+
 bool
 nest::SourceTable::source_should_be_processed_( const thread rank_start,
   const thread rank_end,
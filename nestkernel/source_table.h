@@ -138,7 +138,8 @@ public:
   void finalize();
 
   /**
-   * Reserve memory to avoid expensive reallocation of vectors during
+   * Reserve memory for count additional sources of synapse type syn_id
+   * on thread tid, to avoid expensive reallocation of vectors during
    * connection creation.
    */
   void reserve( const thread tid, const synindex syn_id, const size_t count );
@@ -193,6 +194,12 @@ public:
    */
   index get_node_id( const thread tid, const synindex syn_id, const index lcid ) const;
 
+  /**
+   * Returns the number of bytes allocated for sources of synapse type
+   * syn_id on thread tid.
+   */
+  size_t get_memory_usage( const thread tid, const synindex syn_id ) const;
+
   /**
    * Returns a reference to all sources local on thread; necessary
    * for sorting.
@@ -269,6 +276,18 @@ public:
    */
   void resize_sources( const thread tid );
 
+  /**
+   * Write the sources of all connections of the given thread and
+   * synapse type to a checkpoint.
+   */
+  void write_checkpoint( const thread tid, const synindex syn_id, std::ostream& os ) const;
+
+  /**
+   * Replace the sources of the given thread and synapse type by
+   * those read from a checkpoint.
+   */
+  void read_checkpoint( const thread tid, const synindex syn_id, std::istream& is );
+
   /**
    * Encodes combination of node ID and synapse types as single
    * long number.
@@ -28,6 +28,7 @@
 #include <map>
 
 // Includes from nestkernel:
+#include "memory_status.h"
 #include "nest_types.h"
 
 // Includes from libnestutil
@@ -134,6 +135,11 @@ public:
    */
   index get_max_node_id() const;
 
+  /**
+   * Return the number of bytes allocated for the node entries.
+   */
+  size_t get_memory_usage() const;
+
 private:
   BlockVector< NodeEntry > nodes_; //!< stores local node information
   index max_node_id_;              //!< largest node ID in network
@@ -156,6 +162,12 @@ nest::SparseNodeArray::end() const
   return nodes_.end();
 }
 
+inline size_t
+nest::SparseNodeArray::get_memory_usage() const
+{
+  return allocated_bytes( nodes_ );
+}
+
 inline size_t
 nest::SparseNodeArray::size() const
 {
@@ -23,8 +23,16 @@
 #ifndef STIMULATING_DEVICE_H
 #define STIMULATING_DEVICE_H
 
+// C++ includes:
+#include <string>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
 // Includes from nestkernel:
 #include "device.h"
+#include "device_node.h"
+#include "kernel_manager.h"
 
 // Includes from sli:
 #include "dictutils.h"
@@ -109,6 +117,23 @@ public:
   //! Throws IllegalConnection if synapse id differs from initial synapse id
   void enforce_single_syn_type( synindex );
 
+  /**
+   * Set the stimulation backend from the property stimulus_source and
+   * enroll the node with it. All properties in the dictionary not used
+   * by the node are passed to the backends as device-specific properties.
+   *
+   * This must only be called by devices that implement
+   * DeviceNode::set_data_from_stimulation_backend(). Model prototypes
+   * are not enrolled.
+   */
+  void set_stimulus_source( const DictionaryDatum&, DeviceNode& );
+
+  //! Enroll the node with its stimulation backend, called from set_initialized_()
+  void enroll_stimulus_source( DeviceNode& );
+
+  //! Store stimulus_source and the device-specific backend properties in the dictionary
+  void get_stimulus_source( DictionaryDatum&, const DeviceNode& ) const;
+
 private:
   /**
    * Synapse type of the first outgoing connection made by the Device.
@@ -118,12 +143,20 @@ private:
    * stored here, even though it is an implementation detail.
    */
   synindex first_syn_id_;
+
+  //! Name of the stimulation backend, empty if the stimulus is set by the user
+  std::string stimulus_source_;
+
+  //! Device-specific properties of the stimulation backends
+  DictionaryDatum backend_params_;
 };
 
 template < typename EmittedEvent >
 StimulatingDevice< EmittedEvent >::StimulatingDevice()
   : Device()
   , first_syn_id_( invalid_synindex )
+  , stimulus_source_()
+  , backend_params_( new Dictionary )
 {
 }
 
@@ -131,6 +164,8 @@ template < typename EmittedEvent >
 StimulatingDevice< EmittedEvent >::StimulatingDevice( StimulatingDevice< EmittedEvent > const& sd )
   : Device( sd )
   , first_syn_id_( invalid_synindex ) // a new instance can have no connections
+  , stimulus_source_( sd.stimulus_source_ )
+  , backend_params_( new Dictionary( *sd.backend_params_ ) )
 {
 }
 
@@ -198,6 +233,72 @@ nest::StimulatingDevice< EmittedEvent >::enforce_single_syn_type( synindex syn_i
       "type." );
   }
 }
+
+template < typename EmittedEvent >
+void
+nest::StimulatingDevice< EmittedEvent >::set_stimulus_source( const DictionaryDatum& d, DeviceNode& node )
+{
+  std::string stimulus_source = stimulus_source_;
+  const bool source_changed = updateValue< std::string >( d, names::stimulus_source, stimulus_source );
+  if ( source_changed and not stimulus_source.empty()
+    and not kernel().io_manager.is_valid_stimulation_backend( stimulus_source ) )
+  {
+    throw BadProperty( String::compose( "Unknown stimulation backend '%1'", stimulus_source ) );
+  }
+
+  // the backends read and check their device-specific properties in d
+  kernel().io_manager.check_stimulation_backend_device_status( d );
+
+  // cache the properties given for the backends, so that instances
+  // created from a model prototype receive them when they are enrolled
+  DictionaryDatum backend_defaults( new Dictionary );
+  kernel().io_manager.get_stimulation_backend_device_defaults( backend_defaults );
+  bool params_changed = false;
+  for ( auto kv_pair = backend_defaults->begin(); kv_pair != backend_defaults->end(); ++kv_pair )
+  {
+    if ( d->known( kv_pair->first ) )
+    {
+      ( *backend_params_ )[ kv_pair->first ] = d->lookup( kv_pair->first );
+      params_changed = true;
+    }
+  }
+
+  if ( node.get_node_id() != 0 and ( source_changed or params_changed ) )
+  {
+    kernel().io_manager.enroll_stimulator( stimulus_source, node, *this, backend_params_ );
+  }
+
+  stimulus_source_ = stimulus_source;
+}
+
+template < typename EmittedEvent >
+void
+nest::StimulatingDevice< EmittedEvent >::enroll_stimulus_source( DeviceNode& node )
+{
+  if ( not stimulus_source_.empty() )
+  {
+    kernel().io_manager.enroll_stimulator( stimulus_source_, node, *this, backend_params_ );
+  }
+}
+
+template < typename EmittedEvent >
+void
+nest::StimulatingDevice< EmittedEvent >::get_stimulus_source( DictionaryDatum& d, const DeviceNode& node ) const
+{
+  ( *d )[ names::stimulus_source ] = stimulus_source_;
+
+  kernel().io_manager.get_stimulation_backend_device_defaults( d );
+  for ( auto kv_pair = backend_params_->begin(); kv_pair != backend_params_->end(); ++kv_pair )
+  {
+    ( *d )[ kv_pair->first ] = kv_pair->second;
+  }
+
+  if ( not stimulus_source_.empty() and node.get_node_id() != 0 )
+  {
+    kernel().io_manager.get_stimulation_backend_device_status( stimulus_source_, node, d );
+  }
+}
+
 } // namespace nest
 
 #endif
@@ -0,0 +1,223 @@
+/*
+ *  stimulation_backend.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STIMULATION_BACKEND_H
+#define STIMULATION_BACKEND_H
+
+// Includes from sli:
+#include "dictdatum.h"
+
+namespace nest
+{
+
+class Device;
+class DeviceNode;
+
+/**
+ * Abstract base class for all NESTio stimulation backends
+ *
+ * This class provides the interface for NESTio stimulation backends
+ * with which `StimulatingDevice`s can be enrolled for receiving their
+ * stimulus while the simulation runs. Stimulation backends are the
+ * counterpart of recording backends: they are managed by the IOManager,
+ * which calls their hooks at the same points in the simulation loop.
+ *
+ * A device is enrolled with a stimulation backend by setting its
+ * property `stimulus_source` to the name of the backend. The backend
+ * passes the stimulus of each upcoming time slice to the device by
+ * calling DeviceNode::set_data_from_stimulation_backend(), which
+ * replaces the stimulus set by the user. This allows to drive devices
+ * through long protocols in a single call to Simulate, without the cost
+ * of a Prepare/Cleanup cycle for every change of the stimulus.
+ *
+ * The stimulus is passed as rows of two values, the time of a stimulus
+ * in ms relative to the origin of the device and a value, whose meaning
+ * depends on the device.
+ *
+ * @ingroup NESTio
+ */
+
+class StimulationBackend
+{
+public:
+  StimulationBackend()
+  {
+  }
+
+  virtual ~StimulationBackend() throw()
+  {
+  }
+
+  virtual void initialize() = 0;
+  virtual void finalize() = 0;
+
+  /**
+   * Enroll a stimulating device with the `StimulationBackend`.
+   *
+   * This function is called from the set_initialized_() and set_status()
+   * functions of the device. As for recording backends, it needs to cope
+   * with multiple calls for the same device, and enrollment has to
+   * persist over multiple calls to Prepare, but end with a call to
+   * finalize(). Individual device instances can be identified using
+   * the `thread` and `node_id` of the @p node.
+   *
+   * @param node the stimulating device to be enrolled
+   * @param device the device properties of the node, which determine
+   *        the origin of the times of the stimulus
+   * @param params device-specific backend parameters
+   *
+   * @see disenroll()
+   *
+   * @ingroup NESTio
+   */
+  virtual void enroll( DeviceNode& node, const Device& device, const DictionaryDatum& params ) = 0;
+
+  /**
+   * Disenroll a stimulating device from the `StimulationBackend`.
+   *
+   * This is called for each backend a device is not enrolled with when
+   * the stimulation backend of the device is set.
+   *
+   * @see enroll()
+   *
+   * @ingroup NESTio
+   */
+  virtual void disenroll( DeviceNode& node ) = 0;
+
+  /**
+   * Prepare the backend at begin of the NEST Simulate function.
+   *
+   * This is called by `KernelManager::prepare()` and allows the backend to
+   * open files or establish network connections. It is the last point
+   * at which the backend can report errors by throwing exceptions, as the
+   * hooks below are called during the simulation.
+   *
+   * @see cleanup()
+   *
+   * @ingroup NESTio
+   */
+  virtual void prepare() = 0;
+
+  /**
+   * Clean up the backend at the end of a user level call to the NEST Simulate
+   * function.
+   *
+   * @see prepare()
+   *
+   * @ingroup NESTio
+   */
+  virtual void cleanup() = 0;
+
+  /**
+   * Supply the stimulus for the first time slice of a call to Run.
+   *
+   * This is called by a single thread at the beginning of
+   * `SimulationManager::run()` and has to pass the stimulus to the devices
+   * of all threads.
+   *
+   * @see post_step_hook()
+   *
+   * @ingroup NESTio
+   */
+  virtual void pre_run_hook() = 0;
+
+  /**
+   * Do work required at the end of a call to Run.
+   *
+   * @see pre_run_hook()
+   *
+   * @ingroup NESTio
+   */
+  virtual void post_run_hook() = 0;
+
+  /**
+   * Supply the stimulus for the next time slice.
+   *
+   * This is called by all threads at the end of each time slice, after
+   * the simulation time has been advanced, and has to pass the stimulus to
+   * the devices of the calling thread. It must not throw.
+   *
+   * @see pre_run_hook()
+   *
+   * @ingroup NESTio
+   */
+  virtual void post_step_hook() = 0;
+
+  /**
+   * Set the status of the stimulation backend using the key-value pairs
+   * contained in the params dictionary.
+   *
+   * @see get_status()
+   *
+   * @ingroup NESTio
+   */
+  virtual void set_status( const DictionaryDatum& params ) = 0;
+
+  /**
+   * Return the status of the stimulation backend by writing it to the
+   * given params dictionary.
+   *
+   * @see set_status()
+   *
+   * @ingroup NESTio
+   */
+  virtual void get_status( DictionaryDatum& params ) const = 0;
+
+  /**
+   * Check if the given per-device properties are valid and usable by
+   * the backend.
+   *
+   * The function reads the properties known to the backend from the
+   * dictionary of the device. The device caches the properties listed by
+   * get_device_defaults() and passes them to enroll(). Invalid properties
+   * are reported by throwing BadProperty.
+   *
+   * @see get_device_defaults(), get_device_status()
+   *
+   * @ingroup NESTio
+   */
+  virtual void check_device_status( const DictionaryDatum& params ) const = 0;
+
+  /**
+   * Return the per-device defaults by writing them to the given params
+   * dictionary.
+   *
+   * @see check_device_status(), get_device_status()
+   *
+   * @ingroup NESTio
+   */
+  virtual void get_device_defaults( DictionaryDatum& params ) const = 0;
+
+  /**
+   * Return the per-device status of the given stimulating device by
+   * writing it to the given params dictionary.
+   *
+   * @see enroll(), get_device_defaults()
+   *
+   * @ingroup NESTio
+   */
+  virtual void get_device_status( const DeviceNode& node, DictionaryDatum& params ) const = 0;
+};
+
+} // namespace
+
+#endif // STIMULATION_BACKEND_H
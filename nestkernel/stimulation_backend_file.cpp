@@ -0,0 +1,304 @@
+/*
+ *  stimulation_backend_file.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C++ includes:
+#include <cmath>
+#include <cstring>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+#include "logging.h"
+
+// Includes from nestkernel:
+#include "device.h"
+#include "device_node.h"
+#include "exceptions.h"
+#include "kernel_manager.h"
+#include "vp_manager_impl.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
+#include "stimulation_backend_file.h"
+
+namespace
+{
+const char stimulus_file_magic[] = "NESTSTM1";
+const size_t stimulus_file_magic_length = 8;
+}
+
+nest::StimulationBackendFile::DeviceFile::DeviceFile( DeviceNode& n, const Device& d )
+  : node( &n )
+  , device( &d )
+  , filename()
+  , file()
+  , row()
+  , has_row( false )
+  , supplied_until( 0 )
+  , data()
+{
+}
+
+nest::StimulationBackendFile::StimulationBackendFile()
+{
+}
+
+nest::StimulationBackendFile::~StimulationBackendFile() throw()
+{
+}
+
+void
+nest::StimulationBackendFile::initialize()
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< std::map< index, DeviceFile > >( num_threads ).swap( device_files_ );
+}
+
+void
+nest::StimulationBackendFile::finalize()
+{
+  // closes all files
+  device_files_.clear();
+}
+
+void
+nest::StimulationBackendFile::enroll( DeviceNode& node, const Device& device, const DictionaryDatum& params )
+{
+  std::map< index, DeviceFile >& files = device_files_[ node.get_thread() ];
+  auto device_file = files.find( node.get_node_id() );
+  if ( device_file == files.end() )
+  {
+    device_file = files.insert( std::make_pair( node.get_node_id(), DeviceFile( node, device ) ) ).first;
+  }
+
+  std::string filename;
+  updateValue< std::string >( params, names::filename, filename );
+  if ( filename != device_file->second.filename )
+  {
+    device_file->second.filename = filename;
+    device_file->second.file.reset(); // the new file is opened by the next call to prepare()
+  }
+}
+
+void
+nest::StimulationBackendFile::disenroll( DeviceNode& node )
+{
+  device_files_[ node.get_thread() ].erase( node.get_node_id() );
+}
+
+void
+nest::StimulationBackendFile::prepare()
+{
+  for ( auto& files : device_files_ )
+  {
+    for ( auto& device_file : files )
+    {
+      if ( not device_file.second.file )
+      {
+        open_( device_file.second );
+      }
+    }
+  }
+}
+
+void
+nest::StimulationBackendFile::open_( DeviceFile& device_file )
+{
+  const std::string filename = build_filename_( device_file );
+  std::unique_ptr< std::ifstream > file( new std::ifstream( filename.c_str(), std::ios::binary ) );
+  if ( not file->good() )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+    LOG( M_ERROR, "StimulationBackendFile::prepare()", msg );
+    throw IOError();
+  }
+
+  char magic[ stimulus_file_magic_length ];
+  bool valid = file->read( magic, stimulus_file_magic_length )
+    and std::memcmp( magic, stimulus_file_magic, stimulus_file_magic_length ) == 0;
+
+  // Validate the whole file now, as the stimulus is read during the
+  // simulation, where errors cannot be reported anymore.
+  double previous_time = 0.0;
+  double row[ 2 ];
+  while ( valid and file->read( reinterpret_cast< char* >( row ), sizeof( row ) ) )
+  {
+    valid = std::isfinite( row[ 0 ] ) and row[ 0 ] >= previous_time and std::isfinite( row[ 1 ] );
+    previous_time = row[ 0 ];
+  }
+  valid = valid and file->gcount() == 0;
+
+  if ( not valid )
+  {
+    throw BadProperty( String::compose(
+      "The file '%1' is not a stimulus file, or its times are not sorted and non-negative.", filename ) );
+  }
+
+  file->clear();
+  file->seekg( stimulus_file_magic_length );
+  device_file.file.swap( file );
+  device_file.has_row = read_row_( device_file );
+  device_file.supplied_until = 0;
+}
+
+bool
+nest::StimulationBackendFile::read_row_( DeviceFile& device_file )
+{
+  return static_cast< bool >(
+    device_file.file->read( reinterpret_cast< char* >( device_file.row ), sizeof( device_file.row ) ) );
+}
+
+void
+nest::StimulationBackendFile::supply_( DeviceFile& device_file, const long until )
+{
+  if ( not device_file.file or until <= device_file.supplied_until )
+  {
+    return; // not opened yet, or the stimulus of the time slice has been passed already
+  }
+
+  const Time& origin = device_file.device->get_origin();
+  device_file.data.clear();
+  while ( device_file.has_row and ( origin + Time( Time::ms_stamp( device_file.row[ 0 ] ) ) ).get_steps() <= until )
+  {
+    device_file.data.push_back( device_file.row[ 0 ] );
+    device_file.data.push_back( device_file.row[ 1 ] );
+    device_file.has_row = read_row_( device_file );
+  }
+
+  device_file.node->set_data_from_stimulation_backend( device_file.data );
+  device_file.supplied_until = until;
+}
+
+void
+nest::StimulationBackendFile::cleanup()
+{
+  // nothing to do
+}
+
+void
+nest::StimulationBackendFile::pre_run_hook()
+{
+  const long until =
+    kernel().simulation_manager.get_clock().get_steps() + kernel().connection_manager.get_min_delay();
+  for ( auto& files : device_files_ )
+  {
+    for ( auto& device_file : files )
+    {
+      supply_( device_file.second, until );
+    }
+  }
+}
+
+void
+nest::StimulationBackendFile::post_run_hook()
+{
+  // nothing to do
+}
+
+void
+nest::StimulationBackendFile::post_step_hook()
+{
+  // The clock has been advanced to the start of the next time slice.
+  const long until =
+    kernel().simulation_manager.get_clock().get_steps() + kernel().connection_manager.get_min_delay();
+  for ( auto& device_file : device_files_[ kernel().vp_manager.get_thread_id() ] )
+  {
+    supply_( device_file.second, until );
+  }
+}
+
+void
+nest::StimulationBackendFile::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( d );         // throws if BadProperty
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+void
+nest::StimulationBackendFile::get_status( DictionaryDatum& d ) const
+{
+  P_.get( d );
+}
+
+void
+nest::StimulationBackendFile::check_device_status( const DictionaryDatum& params ) const
+{
+  std::string filename;
+  updateValue< std::string >( params, names::filename, filename );
+}
+
+void
+nest::StimulationBackendFile::get_device_defaults( DictionaryDatum& params ) const
+{
+  ( *params )[ names::filename ] = std::string();
+}
+
+void
+nest::StimulationBackendFile::get_device_status( const DeviceNode& node, DictionaryDatum& d ) const
+{
+  const std::map< index, DeviceFile >& files = device_files_[ node.get_thread() ];
+  const auto device_file = files.find( node.get_node_id() );
+  if ( device_file != files.end() )
+  {
+    ( *d )[ names::filename ] = build_filename_( device_file->second );
+  }
+}
+
+std::string
+nest::StimulationBackendFile::build_filename_( const DeviceFile& device_file ) const
+{
+  if ( not device_file.filename.empty() )
+  {
+    return device_file.filename;
+  }
+
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  return data_path + kernel().io_manager.get_data_prefix() + device_file.node->get_name() + "-"
+    + std::to_string( device_file.node->get_node_id() ) + "." + P_.file_extension_;
+}
+
+/* ******************* Backend parameters ******************* */
+
+nest::StimulationBackendFile::Parameters_::Parameters_()
+  : file_extension_( "stim" )
+{
+}
+
+void
+nest::StimulationBackendFile::Parameters_::get( DictionaryDatum& d ) const
+{
+  ( *d )[ names::file_extension ] = file_extension_;
+}
+
+void
+nest::StimulationBackendFile::Parameters_::set( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::file_extension, file_extension_ );
+}
@@ -0,0 +1,201 @@
+/*
+ *  stimulation_backend_file.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STIMULATION_BACKEND_FILE_H
+#define STIMULATION_BACKEND_FILE_H
+
+// C++ includes:
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+#include "stimulation_backend.h"
+
+/* BeginUserDocs: stimulation backend
+
+.. _file_stimulation_backend:
+
+Read the stimulus from binary files
+###################################
+
+The `file` stimulation backend supplies the stimulus of devices from
+binary files while the simulation runs. A ``spike_generator`` reads its
+spike times and a ``step_current_generator`` its amplitude changes from
+the file, so long stimulation protocols can be run in a single call to
+``Simulate``. The stimulus is read one time slice ahead, so the memory
+needed does not depend on the length of the protocol.
+
+A device reads from the file by setting its property
+``stimulus_source`` to *"file"*. The stimulus set by the properties
+``spike_times`` or ``amplitude_times`` and ``amplitude_values`` is then
+replaced by the stimulus read from the file. Setting
+``stimulus_source`` to the empty string restores control to the user.
+
+Each device reads from its own file. Its name is given by the device
+property ``filename``; if it is not set, the name is determined
+according to the pattern
+
+::
+
+   data_path/data_prefix model_name-node_id.file_extension
+
+where ``data_path`` and ``data_prefix`` are the global kernel
+properties also used by recording backends. The file is opened by the
+first call to ``Prepare`` after the device has been enrolled and stays
+open until ``ResetKernel``, so successive calls to ``Simulate`` continue
+where the previous call stopped.
+
+File format
++++++++++++
+
+A file starts with the eight characters ``NESTSTM1``, followed by rows
+of two 64 bit floating point numbers in the byte order of the machine.
+The first number of a row is the time in ms relative to the origin of
+the device, the second number is the value of the stimulus at that
+time:
+
+- For the ``spike_generator``, the row describes a spike, and the value
+  is the weight of the spike.
+- For the ``step_current_generator``, the row describes a change of the
+  amplitude, and the value is the new amplitude in pA.
+
+Times are rounded to the end of the time step they fall into, as with
+the property ``allow_offgrid_times``. Rows have to be sorted by time.
+
+Parameter summary
++++++++++++++++++
+
+.. glossary::
+
+ file_extension
+   A string (default: *"stim"*) that specifies the file name extension,
+   without leading dot. The generic default was chosen, because the
+   exact type of data cannot be known a priori.
+
+ filename
+   A string (default: *""*) that is set on the device and specifies the
+   file it reads from. If it is empty, the name is determined as
+   described above.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * File-based specialization of the StimulationBackend interface.
+ *
+ * StimulationBackendFile keeps an input stream for each enrolled device
+ * and passes the rows of the next time slice to the device in
+ * pre_run_hook() and post_step_hook(). Files are validated completely
+ * when they are opened in prepare(), as the hooks must not throw.
+ */
+class StimulationBackendFile : public StimulationBackend
+{
+public:
+  StimulationBackendFile();
+
+  ~StimulationBackendFile() throw();
+
+  void initialize() override;
+  void finalize() override;
+
+  void enroll( DeviceNode& node, const Device& device, const DictionaryDatum& params ) override;
+  void disenroll( DeviceNode& node ) override;
+
+  /**
+   * Open and validate the files of newly enrolled devices
+   */
+  void prepare() override;
+
+  void cleanup() override;
+
+  /**
+   * Pass the stimulus of the first time slice to the devices of all threads
+   */
+  void pre_run_hook() override;
+
+  void post_run_hook() override;
+
+  /**
+   * Pass the stimulus of the next time slice to the devices of the calling thread
+   */
+  void post_step_hook() override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const DeviceNode& node, DictionaryDatum& ) const override;
+
+private:
+  /**
+   * Stimulus file of an enrolled device.
+   */
+  struct DeviceFile
+  {
+    DeviceNode* node;
+    const Device* device;
+    std::string filename;                  //!< Name set by the user, empty for the default name
+    std::unique_ptr< std::ifstream > file; //!< Open file, null before the next call to prepare()
+    double row[ 2 ];                       //!< Next row that has not been passed to the device
+    bool has_row;                          //!< False if all rows have been read
+    long supplied_until;                   //!< Last time step for which the stimulus has been passed
+    std::vector< double > data;            //!< Rows passed to the device, kept to avoid allocations
+
+    DeviceFile( DeviceNode&, const Device& );
+  };
+
+  std::string build_filename_( const DeviceFile& ) const;
+  void open_( DeviceFile& );
+
+  //! Read the next row of the file, return false at the end of the file
+  static bool read_row_( DeviceFile& );
+
+  //! Pass the rows up to the given time step to the device
+  static void supply_( DeviceFile&, long until );
+
+  //! Files of enrolled devices per thread, indexed by node ID
+  std::vector< std::map< index, DeviceFile > > device_files_;
+
+  struct Parameters_
+  {
+    std::string file_extension_; //!< File name extension without leading dot
+
+    Parameters_();
+
+    void get( DictionaryDatum& ) const;
+    void set( const DictionaryDatum& );
+  };
+
+  Parameters_ P_;
+};
+
+} // namespace
+
+#endif // STIMULATION_BACKEND_FILE_H
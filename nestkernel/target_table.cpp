@@ -22,6 +22,7 @@
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
+#include "memory_status.h"
 #include "target_table.h"
 
 // Includes from libnestutil
@@ -107,3 +108,9 @@ nest::TargetTable::add_target( const thread tid, const thread target_rank, const
     secondary_send_buffer_pos_[ tid ][ lid ][ syn_id ].push_back( send_buffer_pos );
   }
 }
+
+size_t
+nest::TargetTable::get_memory_usage( const thread tid ) const
+{
+  return allocated_bytes( targets_[ tid ] ) + allocated_bytes( secondary_send_buffer_pos_[ tid ] );
+}
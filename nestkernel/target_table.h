@@ -104,6 +104,12 @@ public:
    */
   void clear( const thread tid );
 
+  /**
+   * Returns the number of bytes allocated for targets and secondary send
+   * buffer positions on thread tid.
+   */
+  size_t get_memory_usage( const thread tid ) const;
+
   /**
    * Removes identical MPI send buffer positions to avoid writing
    * data multiple times.
@@ -23,6 +23,7 @@
 // Includes from nestkernel:
 #include "connector_base.h"
 #include "kernel_manager.h"
+#include "memory_status.h"
 #include "target_table_devices_impl.h"
 #include "vp_manager_impl.h"
 
@@ -194,3 +195,30 @@ nest::TargetTableDevices::get_connections( const index requested_source_node_id,
   get_connections_from_devices_(
     requested_source_node_id, requested_target_node_id, tid, syn_id, synapse_label, conns );
 }
+
+size_t
+nest::TargetTableDevices::get_memory_usage( const thread tid ) const
+{
+  size_t bytes = allocated_bytes( target_to_devices_[ tid ] ) + allocated_bytes( target_from_devices_[ tid ] );
+  for ( const auto& connectors : target_to_devices_[ tid ] )
+  {
+    for ( const ConnectorBase* connector : connectors )
+    {
+      if ( connector != NULL )
+      {
+        bytes += connector->get_memory_usage();
+      }
+    }
+  }
+  for ( const auto& connectors : target_from_devices_[ tid ] )
+  {
+    for ( const ConnectorBase* connector : connectors )
+    {
+      if ( connector != NULL )
+      {
+        bytes += connector->get_memory_usage();
+      }
+    }
+  }
+  return bytes + allocated_bytes( sending_devices_node_ids_[ tid ] );
+}
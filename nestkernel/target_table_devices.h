@@ -192,6 +192,12 @@ public:
     const DictionaryDatum& dict,
     const index lcid );
 
+  /**
+   * Returns the number of bytes allocated for connections from and to
+   * devices on thread tid.
+   */
+  size_t get_memory_usage( const thread tid ) const;
+
   /**
    * Sets synapse status of connection from device to neuron.
    */
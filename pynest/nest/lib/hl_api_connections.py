@@ -41,6 +41,7 @@ __all__ = [
     'CGSelectImplementation',
     'Connect',
     'Disconnect',
+    'GetConnectionArrays',
     'GetConnections',
 ]
 
@@ -113,6 +114,71 @@ def GetConnections(source=None, target=None, synapse_model=None,
     return conns
 
 
+@check_stack
+def GetConnectionArrays(source=None, target=None, synapse_model=None,
+                        synapse_label=None, weights_and_delays=False):
+    """Return the properties of connections as NumPy arrays.
+
+    Selects connections in the same way as :py:func:`.GetConnections`, but
+    returns their properties column-wise. The arrays share the memory filled
+    by the kernel, so retrieving large numbers of connections is much faster
+    than with :py:func:`.GetConnections` followed by ``get()``.
+
+    Parameters
+    ----------
+    source : NodeCollection, optional
+        Source node IDs, only connections from these
+        pre-synaptic neurons are returned
+    target : NodeCollection, optional
+        Target node IDs, only connections to these
+        post-synaptic neurons are returned
+    synapse_model : str, optional
+        Only connections with this synapse type are returned
+    synapse_label : int, optional
+        (non-negative) only connections with this synapse label are returned
+    weights_and_delays : bool, optional
+        If True, weights and delays are returned as well
+
+    Returns
+    -------
+    dict:
+        Integer arrays `source`, `target`, `target_thread`, `synapse_modelid`
+        and `port`, and if requested, float arrays `weight` and `delay`.
+        Entry i of all arrays describes the same connection.
+
+    Raises
+    ------
+    TypeError
+
+    Notes
+    -----
+    Only connections with targets on the MPI process executing
+    the command are returned. Connections are ordered by target thread.
+    """
+
+    params = {}
+
+    if source is not None:
+        if isinstance(source, NodeCollection):
+            params['source'] = source
+        else:
+            raise TypeError("source must be NodeCollection.")
+
+    if target is not None:
+        if isinstance(target, NodeCollection):
+            params['target'] = target
+        else:
+            raise TypeError("target must be NodeCollection.")
+
+    if synapse_model is not None:
+        params['synapse_model'] = kernel.SLILiteral(synapse_model)
+
+    if synapse_label is not None:
+        params['synapse_label'] = synapse_label
+
+    return get_connection_arrays(params, weights_and_delays)
+
+
 @check_stack
 def Connect(pre, post, conn_spec=None, syn_spec=None,
             return_synapsecollection=False):
@@ -35,6 +35,7 @@ import nest
 __all__ = [
     'authors',
     'get_argv',
+    'GetRecordingArrays',
     'GetStatus',
     'get_verbosity',
     'help',
@@ -386,3 +387,43 @@ def GetStatus(nodes, keys=None, output=''):
         result = to_json(result)
 
     return result
+
+
+@check_stack
+def GetRecordingArrays(recorder, drain=False):
+    """Return the events of a recording device as NumPy arrays.
+
+    The recorder has to record to the `memory` backend. The arrays share
+    the memory holding the events in the kernel, so retrieving large numbers
+    of events is much faster than reading the property `events`.
+
+    Parameters
+    ----------
+    recorder : NodeCollection
+        `NodeCollection` with a single recording device
+    drain : bool, optional
+        If True, the events are moved out of the recorder instead of being
+        copied, which leaves the recorder empty. Its property `n_events`
+        is not reset.
+
+    Returns
+    -------
+    dict:
+        Arrays `senders` and `times` and one array per recorded value. If the
+        recorder has `time_in_steps` set, `times` holds integer time steps
+        and an additional array `offsets` holds the offsets in ms.
+
+    Raises
+    ------
+    TypeError
+        If `recorder` is not a `NodeCollection` with a single node.
+
+    See Also
+    --------
+    GetStatus
+    """
+
+    if not isinstance(recorder, nest.NodeCollection) or len(recorder) != 1:
+        raise TypeError("recorder must be a NodeCollection with a single node")
+
+    return get_recording_arrays(recorder.tolist()[0], drain)
@@ -29,6 +29,7 @@ from ..ll_api import *
 from .hl_api_helper import *
 
 __all__ = [
+    'Checkpoint',
     'Cleanup',
     'DisableStructuralPlasticity',
     'EnableStructuralPlasticity',
@@ -37,6 +38,7 @@ __all__ = [
     'Install',
     'Prepare',
     'ResetKernel',
+    'Restore',
     'Run',
     'RunManager',
     'SetKernelStatus',
@@ -128,6 +130,52 @@ def Cleanup():
     sr('Cleanup')
 
 
+@check_stack
+def Checkpoint(name):
+    """Write the state of the network to checkpoint files.
+
+    Each MPI process writes its nodes, connections, random number generator
+    states and the simulation time to the file
+    `<data_path>/<data_prefix><name>-<rank>.ckpt`. Checkpoints can only be
+    restored by the same build of NEST with the same number of processes,
+    threads and the same resolution.
+
+    Parameters
+    ----------
+    name : str
+        Name of the checkpoint
+
+    See Also
+    --------
+    Restore
+    """
+
+    sps(name)
+    sr('Checkpoint')
+
+
+@check_stack
+def Restore(name):
+    """Re-create the network from checkpoint files written by `Checkpoint`.
+
+    The kernel must not contain any nodes, i.e. `ResetKernel` must be called
+    first. Custom models created by `CopyModel` need to be created again
+    before the checkpoint is restored.
+
+    Parameters
+    ----------
+    name : str
+        Name of the checkpoint
+
+    See Also
+    --------
+    Checkpoint
+    """
+
+    sps(name)
+    sr('Restore')
+
+
 @contextmanager
 def RunManager():
     """ContextManager for `Run`
@@ -236,8 +284,21 @@ def SetKernelStatus(params):
         The local number of threads
     num_processes : int, read only
         The number of MPI processes
+    rank : int, read only, local only
+        The rank of this MPI process
     off_grid_spiking : bool
         Whether to transmit precise spike times in MPI communication
+    pipelined_spike_exchange : bool
+        Whether to exchange the spikes of one time slice while the next slice
+        is updated, using non-blocking MPI communication. Requires all delays
+        to be at least twice min_delay; set min_delay and max_delay
+        explicitly. Cannot be combined with structural plasticity and must be
+        set before the first call to Simulate.
+    population_update : bool
+        Whether to update all neurons of a model on a thread together, using
+        one array per state variable, where the model supports it (currently
+        iaf_psc_alpha, iaf_psc_exp and iaf_psc_delta). Results are identical
+        to the update of individual neurons.
     grng_seed : int
         Seed for global random number generator used synchronously by all
         virtual processes to create, e.g., fixed fan-out connections.
@@ -339,6 +400,66 @@ def SetKernelStatus(params):
         devices such as poisson_generator.
 
 
+    Detailed timers
+
+    Only available if NEST was configured with ``-Dwith-detailed-timers=ON``.
+    Each entry is a list with one value per local thread, giving the
+    wall-clock time in seconds accumulated during the last call to Run.
+
+    Returns
+    -------
+
+    time_update : list of float, read only
+        Time spent updating nodes
+    time_wfr_update : list of float, read only
+        Time spent in waveform relaxation iterations, including the
+        secondary events exchanged between iterations
+    time_collocate_spike_data : list of float, read only
+        Time spent moving spikes from the spike register to MPI buffers
+    time_communicate_spike_data : list of float, read only
+        Time spent communicating spikes via MPI (only charged to the
+        thread that performs the communication)
+    time_deliver_spike_data : list of float, read only
+        Time spent delivering received spikes to their targets
+    time_gather_secondary_events : list of float, read only
+        Time spent communicating secondary events via MPI
+    time_deliver_secondary_events : list of float, read only
+        Time spent delivering received secondary events to their targets
+    time_post_step_hook : list of float, read only
+        Time spent in post-step activities of the recording backends
+    time_omp_synchronization : list of float, read only
+        Time spent waiting for other threads after node update, after
+        delivery and after the post-step activities
+
+
+    Memory
+
+    The entry ``memory`` is a dictionary with one entry per subsystem
+    (``connections``, ``source_table``, ``target_table``,
+    ``target_table_devices``, ``spike_register``, ``mpi_buffers``, ``nodes``
+    and ``node_buffers``) and the sum of all subsystems as ``total``. Each
+    subsystem is described by a dictionary with the allocated bytes as
+    ``total``, the allocated bytes of each local thread as ``per_thread``
+    and, for ``connections`` and ``source_table``, the allocated bytes of
+    each synapse model as ``per_synapse_model``. Values are computed from
+    the capacities of the data structures and do not include allocator
+    overhead. Ring buffers are currently accounted for ``iaf_psc_alpha``,
+    ``iaf_psc_exp`` and ``iaf_psc_delta`` only.
+
+    Returns
+    -------
+
+    memory : dict, read only, local only
+        Memory allocated by the kernel on this MPI process
+    memory_forecast : dict, read only, local only
+        Only available after ``SetFakeNumProcesses``: memory predicted for
+        the simulation on the faked rank, with the same layout as
+        ``memory``. Includes the target table, MPI buffers and ring buffers,
+        which are only allocated when the simulation is prepared. The target
+        table is estimated assuming that connections are evenly distributed
+        across ranks.
+
+
     Miscellaneous
 
     Other Parameters
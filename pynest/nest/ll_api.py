@@ -53,6 +53,8 @@ from . import pynestkernel as kernel      # noqa
 __all__ = [
     'check_stack',
     'connect_arrays',
+    'get_connection_arrays',
+    'get_recording_arrays',
     'set_communicator',
     'get_debug',
     'set_debug',
@@ -74,6 +76,8 @@ sli_push = sps = engine.push
 sli_pop = spp = engine.pop
 take_array_index = engine.take_array_index
 connect_arrays = engine.connect_arrays
+get_connection_arrays = engine.get_connection_arrays
+get_recording_arrays = engine.get_recording_arrays
 
 
 def catching_sli_run(cmd):
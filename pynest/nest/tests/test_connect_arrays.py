@@ -76,6 +76,29 @@ class TestConnectArrays(unittest.TestCase):
             self.assertEqual(conn_w, w)
             self.assertEqual(conn_d, d)
 
+    def test_connect_arrays_threaded_distinct_values(self):
+        """Connecting NumPy arrays with distinct weights and delays, threaded"""
+        nest.SetKernelStatus({'local_num_threads': 3})
+        n = 10
+        nest.Create('iaf_psc_alpha', n)
+        sources = np.repeat(np.arange(1, n+1, dtype=np.uint64), n)
+        targets = np.tile(np.arange(1, n+1, dtype=np.uint64), n)
+        weights = np.arange(len(sources), dtype=np.double)
+        delays = 1. + 0.1 * (np.arange(len(sources)) % 7)
+        syn_model = 'static_synapse'
+
+        nest.Connect(sources, targets, syn_spec={'weight': weights, 'delay': delays,
+                                                 'synapse_model': syn_model})
+
+        conns = nest.GetConnectionArrays(weights_and_delays=True)
+        self.assertEqual(len(conns['source']), len(sources))
+        # Weights are unique, so they identify the connection.
+        order = np.argsort(conns['weight'])
+        np.testing.assert_array_equal(conns['source'][order], sources)
+        np.testing.assert_array_equal(conns['target'][order], targets)
+        np.testing.assert_array_equal(conns['weight'][order], weights)
+        np.testing.assert_array_almost_equal(conns['delay'][order], delays)
+
     def test_connect_arrays_no_delays(self):
         """Connecting NumPy arrays without specifying delays"""
         n = 10
@@ -146,10 +146,37 @@ cdef extern from "neststartup.h":
     cbool nest_has_mpi4py()
     void c_set_communicator "set_communicator" (object) with gil
 
+cdef extern from "connection_columns.h" namespace "nest":
+    cppclass ConnectionColumns:
+        ConnectionColumns() except +
+        vector[long] sources
+        vector[long] targets
+        vector[long] target_threads
+        vector[long] synapse_ids
+        vector[long] ports
+        vector[double] weights
+        vector[double] delays
+        cbool with_weights_and_delays
+
+cdef extern from "recording_columns.h" namespace "nest":
+    cppclass RecordingColumns:
+        RecordingColumns() except +
+        vector[long] senders
+        vector[double] times
+        vector[long] time_steps
+        vector[double] offsets
+        vector[string] double_value_names
+        vector[vector[double]] double_values
+        vector[string] long_value_names
+        vector[vector[long]] long_values
+        cbool time_in_steps
+
 cdef extern from "nest.h" namespace "nest":
     Datum* node_collection_array_index(const Datum* node_collection, const long* array, unsigned long n) except +
     Datum* node_collection_array_index(const Datum* node_collection, const cbool* array, unsigned long n) except +
     void connect_arrays( long* sources, long* targets, double* weights, double* delays, vector[string]& p_keys, double* p_values, size_t n, string syn_model ) except +
+    void get_connection_columns(const DictionaryDatum& params, ConnectionColumns& columns) except +
+    void get_recording_columns(size_t node_id, cbool drain, RecordingColumns& columns) except +
 
 cdef extern from *:
 
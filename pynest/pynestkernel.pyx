@@ -152,6 +152,84 @@ cdef class SLILiteral(object):
             return self.name >= obj
 
 
+cdef class ConnectionColumnsHolder(object):
+    """Owns the ConnectionColumns filled by NESTEngine.get_connection_arrays"""
+
+    cdef ConnectionColumns* thisptr
+
+    def __cinit__(self):
+        self.thisptr = new ConnectionColumns()
+
+    def __dealloc__(self):
+        del self.thisptr
+
+
+cdef class RecordingColumnsHolder(object):
+    """Owns the RecordingColumns filled by NESTEngine.get_recording_arrays"""
+
+    cdef RecordingColumns* thisptr
+
+    def __cinit__(self):
+        self.thisptr = new RecordingColumns()
+
+    def __dealloc__(self):
+        del self.thisptr
+
+
+cdef class ConnectionColumn(object):
+    """Exposes one column of a ConnectionColumnsHolder or a
+    RecordingColumnsHolder through the buffer protocol
+
+    NumPy arrays created from a ConnectionColumn share its memory. They
+    keep the ConnectionColumn, and thereby the holder, alive.
+    """
+
+    cdef object holder
+    cdef void* data
+    cdef char* fmt
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t strides[1]
+
+    cdef _set_column(self, object holder, void* data, char* fmt, Py_ssize_t itemsize, Py_ssize_t size):
+        self.holder = holder
+        self.data = data
+        self.fmt = fmt
+        self.shape[0] = size
+        self.strides[0] = itemsize
+
+    def __getbuffer__(self, Py_buffer* buffer, int flags):
+        buffer.buf = self.data
+        buffer.format = self.fmt
+        buffer.internal = NULL
+        buffer.itemsize = self.strides[0]
+        buffer.len = self.shape[0] * self.strides[0]
+        buffer.ndim = 1
+        buffer.obj = self
+        buffer.readonly = 0
+        buffer.shape = self.shape
+        buffer.strides = self.strides
+        buffer.suboffsets = NULL
+
+    def __releasebuffer__(self, Py_buffer* buffer):
+        pass
+
+
+cdef object long_column_to_array(object holder, vector[long]& column):
+    if column.empty():
+        return numpy.empty(0, dtype=numpy.long)
+    cdef ConnectionColumn col = ConnectionColumn()
+    col._set_column(holder, <void*> column.data(), b'l', sizeof(long), column.size())
+    return numpy.asarray(col)
+
+
+cdef object double_column_to_array(object holder, vector[double]& column):
+    if column.empty():
+        return numpy.empty(0, dtype=numpy.double)
+    cdef ConnectionColumn col = ConnectionColumn()
+    col._set_column(holder, <void*> column.data(), b'd', sizeof(double), column.size())
+    return numpy.asarray(col)
+
+
 cdef class NESTEngine(object):
 
     cdef SLIInterpreter* pEngine
@@ -359,6 +437,73 @@ cdef class NESTEngine(object):
             exceptionCls = getattr(NESTErrors, str(e))
             raise exceptionCls('connect_arrays', '') from None
 
+    def get_connection_arrays(self, params, with_weights_and_delays):
+        """Calls get_connection_columns function, returning the columns as NumPy arrays without copying"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not HAVE_NUMPY:
+            raise NESTErrors.PyNESTError("NumPy is not available")
+        if not isinstance(params, dict):
+            raise TypeError('params must be a dict')
+
+        cdef ConnectionColumnsHolder holder = ConnectionColumnsHolder()
+        holder.thisptr.with_weights_and_delays = with_weights_and_delays
+
+        cdef Datum* params_datum = python_object_to_datum(params)
+
+        try:
+            get_connection_columns(deref_dict(<DictionaryDatum*> params_datum), deref(holder.thisptr))
+        except RuntimeError as e:
+            exceptionCls = getattr(NESTErrors, str(e))
+            raise exceptionCls('get_connection_arrays', '') from None
+        finally:
+            del params_datum
+
+        result = {
+            'source': long_column_to_array(holder, holder.thisptr.sources),
+            'target': long_column_to_array(holder, holder.thisptr.targets),
+            'target_thread': long_column_to_array(holder, holder.thisptr.target_threads),
+            'synapse_modelid': long_column_to_array(holder, holder.thisptr.synapse_ids),
+            'port': long_column_to_array(holder, holder.thisptr.ports),
+        }
+        if with_weights_and_delays:
+            result['weight'] = double_column_to_array(holder, holder.thisptr.weights)
+            result['delay'] = double_column_to_array(holder, holder.thisptr.delays)
+
+        return result
+
+    def get_recording_arrays(self, node_id, drain):
+        """Calls get_recording_columns function, returning the columns as NumPy arrays without copying"""
+        if self.pEngine is NULL:
+            raise NESTErrors.PyNESTError("engine uninitialized")
+        if not HAVE_NUMPY:
+            raise NESTErrors.PyNESTError("NumPy is not available")
+
+        cdef RecordingColumnsHolder holder = RecordingColumnsHolder()
+
+        try:
+            get_recording_columns(node_id, drain, deref(holder.thisptr))
+        except RuntimeError as e:
+            exceptionCls = getattr(NESTErrors, str(e))
+            raise exceptionCls('get_recording_arrays', '') from None
+
+        result = {'senders': long_column_to_array(holder, holder.thisptr.senders)}
+        if holder.thisptr.time_in_steps:
+            result['times'] = long_column_to_array(holder, holder.thisptr.time_steps)
+            result['offsets'] = double_column_to_array(holder, holder.thisptr.offsets)
+        else:
+            result['times'] = double_column_to_array(holder, holder.thisptr.times)
+
+        cdef size_t i
+        for i in range(holder.thisptr.double_values.size()):
+            name = holder.thisptr.double_value_names[i].decode()
+            result[name] = double_column_to_array(holder, holder.thisptr.double_values[i])
+        for i in range(holder.thisptr.long_values.size()):
+            name = holder.thisptr.long_value_names[i].decode()
+            result[name] = long_column_to_array(holder, holder.thisptr.long_values[i])
+
+        return result
+
 cdef inline Datum* python_object_to_datum(obj) except NULL:
 
     cdef Datum* ret = NULL
@@ -238,6 +238,8 @@ SLIStartup::SLIStartup( int argc, char** argv )
   , have_recordingbackend_arbor_name( "have_recordingbackend_arbor" )
   , have_libneurosim_name( "have_libneurosim" )
   , have_sionlib_name( "have_sionlib" )
+  , have_zlib_name( "have_zlib" )
+  , have_detailed_timers_name( "have_detailed_timers" )
   , ndebug_name( "ndebug" )
   , exitcodes_name( "exitcodes" )
   , exitcode_success_name( "success" )
@@ -449,6 +451,18 @@ SLIStartup::init( SLIInterpreter* i )
   statusdict->insert( have_sionlib_name, Token( new BoolDatum( false ) ) );
 #endif
 
+#ifdef HAVE_ZLIB
+  statusdict->insert( have_zlib_name, Token( new BoolDatum( true ) ) );
+#else
+  statusdict->insert( have_zlib_name, Token( new BoolDatum( false ) ) );
+#endif
+
+#ifdef TIMER_DETAILED
+  statusdict->insert( have_detailed_timers_name, Token( new BoolDatum( true ) ) );
+#else
+  statusdict->insert( have_detailed_timers_name, Token( new BoolDatum( false ) ) );
+#endif
+
 #ifdef NDEBUG
   statusdict->insert( ndebug_name, Token( new BoolDatum( true ) ) );
 #else
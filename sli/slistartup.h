@@ -111,6 +111,8 @@ public:
   Name have_recordingbackend_arbor_name;
   Name have_libneurosim_name;
   Name have_sionlib_name;
+  Name have_zlib_name;
+  Name have_detailed_timers_name;
   Name ndebug_name;
 
   Name exitcodes_name;
@@ -113,6 +113,30 @@ BOOST_AUTO_TEST_CASE( test_clear )
   BOOST_REQUIRE( n_elements == 0 );
 }
 
+BOOST_AUTO_TEST_CASE( test_reserve )
+{
+  BlockVector< int > block_vector;
+  int N = 3 * block_vector.get_max_block_size() + 10;
+  block_vector.push_back( -1 );
+  block_vector.reserve( N );
+
+  BOOST_REQUIRE( block_vector.size() == 1 );
+  for ( int i = 1; i < N + 10; ++i )
+  {
+    block_vector.push_back( i );
+  }
+
+  BOOST_REQUIRE( block_vector.size() == ( size_t ) N + 10 );
+  BOOST_REQUIRE( block_vector[ 0 ] == -1 );
+  int n_elements = 0;
+  for ( auto it = block_vector.begin() + 1; it != block_vector.end(); ++it )
+  {
+    ++n_elements;
+    BOOST_REQUIRE( *it == n_elements );
+  }
+  BOOST_REQUIRE( n_elements == N + 9 );
+}
+
 BOOST_AUTO_TEST_CASE( test_erase )
 {
   int N = 10;